@@ -1,6 +1,7 @@
 #ifndef app_Handler_h
 #define app_Handler_h
 
+#include "support/IntrusiveList.h"
 #include "support/Utilities.h"
 
 class Message;
@@ -81,8 +82,16 @@ protected:
 
 private:
 
-    Handler*    m_nextHandler;
-    ::Looper*   m_looper;
+    //
+    //  Der Looper verkettet seine Handler ueber m_looperHook, so dass
+    //  AddHandler() und RemoveHandler() ohne Speicheranforderung und in
+    //  konstanter Zeit auskommen.
+    //
+    friend class ::Looper;
+
+    Handler*                    m_nextHandler;
+    ::Looper*                   m_looper;
+    IntrusiveListHook<Handler>  m_looperHook;
 };
 
 //----------------------------------------------------------------------------
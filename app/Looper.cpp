@@ -5,7 +5,8 @@
 Looper::Looper(uint capacity)
     : m_defaultHandler(nullptr),
       m_currentMessage(nullptr),
-      m_messageQueue(capacity)
+      m_messageQueue(capacity),
+      m_signalEvents(nullptr)
 {}
 
 //----------------------------------------------------------------------------
@@ -19,12 +20,28 @@ Looper::~Looper()
         delete m_currentMessage;
 
     m_handlers.DoForEach(UnlinkHandler);
+
+    SignalEvent* event =
+        m_signalEvents.Exchange(nullptr, MEMORY_ORDER_ACQUIRE);
+
+    while (event != nullptr)
+    {
+        SignalEvent* next = event->next;
+        delete event;
+        event = next;
+    }
 }
 
 //----------------------------------------------------------------------------
 
 void Looper::AddHandler(Handler* handler)
 {
+    if (m_handlers.Contains(handler))
+        return;
+
+    if (handler->Looper() != nullptr)
+        handler->Looper()->RemoveHandler(handler);
+
     m_handlers.Append(handler);
     handler->SetLooper(this);
 }
@@ -33,7 +50,7 @@ void Looper::AddHandler(Handler* handler)
 
 bool Looper::RemoveHandler(Handler* handler)
 {
-    if (!m_handlers.RemoveRef(handler))
+    if (!m_handlers.Remove(handler))
         return false;
 
     handler->SetLooper(nullptr);
@@ -77,6 +94,17 @@ bool Looper::PostMessage(uint what, Handler* handler)
 
 //----------------------------------------------------------------------------
 
+void Looper::PostSignalEvent(SignalEvent* event)
+{
+    SignalEvent* head = m_signalEvents.Load(MEMORY_ORDER_RELAXED);
+    event->next = head;
+
+    while (!m_signalEvents.CompareExchange(head, event, MEMORY_ORDER_RELEASE))
+        event->next = head;
+}
+
+//----------------------------------------------------------------------------
+
 void Looper::DispatchMessage(Message* message)
 {
     Handler* handler = message->Handler();
@@ -108,6 +136,8 @@ bool Looper::QuitRequested()
 
 void Looper::DispatchNextMessage()
 {
+    DispatchSignalEvents();
+
     if (m_messageQueue.NextMessage())
     {
         m_currentMessage = m_messageQueue.GetNextMessage();
@@ -118,3 +148,35 @@ void Looper::DispatchNextMessage()
 }
 
 //----------------------------------------------------------------------------
+
+void Looper::DispatchSignalEvents()
+{
+    //  Die Produzenten legen neue Ereignisse vorne an die Liste an. Die
+    //  entnommene Liste wird daher umgedreht, damit die Ereignisse in der
+    //  Reihenfolge ihres Eintreffens ausgefuehrt werden.
+
+    if (m_signalEvents.Load(MEMORY_ORDER_RELAXED) == nullptr)
+        return;
+
+    SignalEvent* event =
+        m_signalEvents.Exchange(nullptr, MEMORY_ORDER_ACQUIRE);
+    SignalEvent* list = nullptr;
+
+    while (event != nullptr)
+    {
+        SignalEvent* next = event->next;
+        event->next = list;
+        list = event;
+        event = next;
+    }
+
+    while (list != nullptr)
+    {
+        SignalEvent* next = list->next;
+        list->Deliver();
+        delete list;
+        list = next;
+    }
+}
+
+//----------------------------------------------------------------------------
@@ -4,7 +4,9 @@
 #include "app/Handler.h"
 #include "app/Message.h"
 #include "app/MessageQueue.h"
-#include "support/List.h"
+#include "support/Atomic.h"
+#include "support/IntrusiveList.h"
+#include "support/Signal.h"
 #include "support/Utilities.h"
 
 //----------------------------------------------------------------------------
@@ -16,7 +18,12 @@
 //  Objekte weitergeleitet, die sich mit der Funktion AddHandler() registriert
 //  haben.
 //
-class Looper: public Handler
+//  Als SignalDispatcher nimmt ein Looper ausserdem SignalEvents aus anderen
+//  Threads entgegen (siehe Signal::ConnectQueued()). Diese werden ohne Sperre
+//  in eine eigene Liste eingereiht und von DispatchNextMessage() im Thread
+//  des Loopers ausgefuehrt.
+//
+class Looper: public Handler, public SignalDispatcher
 {
 public:
 
@@ -80,7 +87,16 @@ public:
     bool PostMessage(uint what, Handler* handler = nullptr);
 
     //
-    //  Fuegt der Handler-Liste das Handler-Objekt handler hinzu.
+    //  Reiht event zur Ausfuehrung im Thread des Loopers ein. Die Funktion
+    //  kann aus beliebigen Threads aufgerufen werden und kommt ohne Sperre
+    //  aus. Der Looper uebernimmt event und loescht es nach der Ausfuehrung.
+    //
+    void PostSignalEvent(SignalEvent* event);
+
+    //
+    //  Fuegt der Handler-Liste das Handler-Objekt handler hinzu. Ist der
+    //  Handler noch mit einem anderen Looper verbunden, wird er zuvor aus
+    //  dessen Liste entfernt.
     //
     virtual void AddHandler(Handler* handler);
 
@@ -129,17 +145,26 @@ protected:
     { handler->SetLooper(nullptr); }
 
     //
-    //  Verteilt die naechste Botschaft, falls die Botschafts-Warteschlange
-    //  nicht leer ist.
+    //  Fuehrt alle eingereihten SignalEvents aus und verteilt danach die
+    //  naechste Botschaft, falls die Botschafts-Warteschlange nicht leer ist.
     //
     virtual void DispatchNextMessage();
 
 private:
 
-    Handler*        m_defaultHandler;
-    List<Handler>   m_handlers;
-    Message*        m_currentMessage;
-    ::MessageQueue  m_messageQueue;
+    //
+    //  Fuehrt die bis jetzt eingereihten SignalEvents in der Reihenfolge
+    //  ihres Eintreffens aus und loescht sie.
+    //
+    void DispatchSignalEvents();
+
+    typedef IntrusiveList<Handler, &Handler::m_looperHook> HandlerList;
+
+    Handler*                m_defaultHandler;
+    HandlerList             m_handlers;
+    Message*                m_currentMessage;
+    ::MessageQueue          m_messageQueue;
+    Atomic<SignalEvent*>    m_signalEvents;
 };
 
 //----------------------------------------------------------------------------
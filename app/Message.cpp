@@ -2,15 +2,31 @@
 
 //----------------------------------------------------------------------------
 
-void Message::DataInfo::Init(const char* name, type_code type,
+const Atom FIELD_ACTIVE("active");
+const Atom FIELD_BUTTON("button");
+const Atom FIELD_CHAR("char");
+const Atom FIELD_COMMAND("cmd");
+const Atom FIELD_ENABLED("enabled");
+const Atom FIELD_FOCUSED("focused");
+const Atom FIELD_HEIGHT("height");
+const Atom FIELD_KEY("key");
+const Atom FIELD_KEYS("keys");
+const Atom FIELD_SHOW("show");
+const Atom FIELD_TIMER("timer");
+const Atom FIELD_WIDTH("width");
+const Atom FIELD_XPOS("xpos");
+const Atom FIELD_YPOS("ypos");
+
+//----------------------------------------------------------------------------
+
+void Message::DataInfo::Init(const Atom& name, type_code type,
                              const void* data, ulong size)
 {
-    this->name = new char[strlen(name) + 1];
+    this->name = name;
     this->type = type;
     this->data = new char[size];
     this->size = size;
 
-    strcpy(this->name, name);
     memcpy(this->data, data, size);
 }
 
@@ -20,9 +36,7 @@ Message::Message(uint what, ::Handler* handler)
     : what(what),
       m_handler(handler),
       m_infoList(4)
-{
-    m_infoList.SetAutoDelete(true);
-}
+{}
 
 //----------------------------------------------------------------------------
 
@@ -31,8 +45,6 @@ Message::Message(const Message& message)
       m_handler(message.m_handler),
       m_infoList(message.m_infoList.Capacity())
 {
-    m_infoList.SetAutoDelete(true);
-
     for (uint i = 0; i < message.m_infoList.Count(); ++i)
         m_infoList.Append(new DataInfo(*message.m_infoList[i]));
 }
@@ -46,13 +58,31 @@ Message::~Message()
 
 //----------------------------------------------------------------------------
 
-uint Message::Locate(const char* name, uint pos) const
+Message& Message::operator=(const Message& message)
+{
+    if (this != &message)
+    {
+        m_infoList.Clear();
+
+        for (uint i = 0; i < message.m_infoList.Count(); ++i)
+            m_infoList.Append(new DataInfo(*message.m_infoList[i]));
+
+        what = message.what;
+        m_handler = message.m_handler;
+    }
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------
+
+uint Message::Locate(const Atom& name, uint pos) const
 {
     uint end = m_infoList.End();
 
     while (pos != end)
     {
-        if (strcmp(name, m_infoList[pos]->name) == 0)
+        if (m_infoList[pos]->name == name)
             break;
 
         ++pos;
@@ -63,10 +93,13 @@ uint Message::Locate(const char* name, uint pos) const
 
 //----------------------------------------------------------------------------
 
-bool Message::ReplaceData(const char* name, type_code type, void* data,
-                          ulong size)
+bool Message::ReplaceData(const AtomLookup& name, type_code type,
+                          void* data, ulong size)
 {
-    DataInfo* info = m_infoList.At(Locate(name));
+    if (!name.IsKnown())
+        return false;
+
+    DataInfo* info = m_infoList.At(Locate(name.Get()));
 
     if (!info)
         return false;
@@ -83,10 +116,13 @@ bool Message::ReplaceData(const char* name, type_code type, void* data,
 
 //----------------------------------------------------------------------------
 
-bool Message::FindData(const char* name, type_code type, void** data,
+bool Message::FindData(const AtomLookup& name, type_code type, void** data,
                        ulong* size) const
 {
-    DataInfo* info = m_infoList.At(Locate(name));
+    if (!name.IsKnown())
+        return false;
+
+    DataInfo* info = m_infoList.At(Locate(name.Get()));
 
     if (!info)
         return false;
@@ -113,9 +149,12 @@ void Message::Clear()
 
 //----------------------------------------------------------------------------
 
-bool Message::RemoveName(const char* name)
+bool Message::RemoveName(const AtomLookup& name)
 {
-    uint pos = Locate(name);
+    if (!name.IsKnown())
+        return false;
+
+    uint pos = Locate(name.Get());
 
     if (pos == m_infoList.End())
         return false;
@@ -123,7 +162,7 @@ bool Message::RemoveName(const char* name)
     while (pos != m_infoList.End())
     {
         m_infoList.Remove(pos);
-        pos = Locate(name, pos);
+        pos = Locate(name.Get(), pos);
     }
 
     return true;
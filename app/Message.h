@@ -3,9 +3,10 @@
 
 #include "interface/Point.h"
 #include "interface/Rect.h"
+#include "support/Atom.h"
 #include "support/String.h"
+#include "support/SmallVector.h"
 #include "support/Utilities.h"
-#include "support/Vector.h"
 
 #include <cstring>
 
@@ -86,6 +87,29 @@ enum
     ALT_DOWN                    = 0x0020
 };
 
+//----------------------------------------------------------------------------
+//
+//  Bezeichner der Felder von Systembotschaften. Maus- und Tastatur-
+//  botschaften enthalten "xpos", "ypos", "keys", "button", "key" bzw.
+//  "char" als int, MSG_PULSE "timer", MSG_COMMAND "cmd", MSG_VIEW_RESIZED
+//  "width" und "height", MSG_VIEW_MOVED "xpos" und "ypos"; die Felder
+//  "focused", "show", "enabled" und "active" sind bool.
+//
+extern const Atom FIELD_ACTIVE;
+extern const Atom FIELD_BUTTON;
+extern const Atom FIELD_CHAR;
+extern const Atom FIELD_COMMAND;
+extern const Atom FIELD_ENABLED;
+extern const Atom FIELD_FOCUSED;
+extern const Atom FIELD_HEIGHT;
+extern const Atom FIELD_KEY;
+extern const Atom FIELD_KEYS;
+extern const Atom FIELD_SHOW;
+extern const Atom FIELD_TIMER;
+extern const Atom FIELD_WIDTH;
+extern const Atom FIELD_XPOS;
+extern const Atom FIELD_YPOS;
+
 //----------------------------------------------------------------------------
 //
 //  Botschafts-Klasse zur flexiblen Kommunikation zwischen Objekten.
@@ -96,6 +120,15 @@ enum
 //  Daten werden dazu ueber eine Typkonstante (z.B. LONG_TYPE, POINTER_TYPE
 //  etc.) und einen Zeichenketten-Bezeichner identifiziert.
 //
+//  Die Bezeichner werden als Atom gespeichert, so dass das Suchen eines
+//  Eintrags nur Zeiger vergleicht und das Hinzufuegen keinen Speicher fuer
+//  den Namen anfordert. Zeichenketten werden beim Hinzufuegen automatisch
+//  in ein Atom umgewandelt. Die Such- und Entfernfunktionen schlagen
+//  Zeichenketten dagegen nur nach (siehe AtomLookup) und tragen keine
+//  neuen Namen ein. Wer dieselben Bezeichner haeufig verwendet, sollte die
+//  Atome einmal anlegen und wiederverwenden, wie die FIELD_-Konstanten fuer
+//  die Felder der Systembotschaften.
+//
 //  Jedes Message-Objekt erhaelt darueber hinaus eine Message-Konstante, die
 //  die Art der Botschaft identifiziert. Zugriff auf den Message-Typ liefert
 //  die public-Variable what.
@@ -132,6 +165,12 @@ public:
     //
     virtual ~Message();
 
+    //
+    //  Ersetzt die Daten des Message-Objektes durch Kopien der in message
+    //  enthaltenen Daten.
+    //
+    Message& operator=(const Message& message);
+
     //
     //  Liefert true, wenn das Message-Objekt eine Systembotschaft enthaelt.
     //
@@ -157,56 +196,56 @@ public:
     //  Zeiger auf die zu kopierenden Daten und size die Anzahl der zu
     //  kopierenden Bytes enthalten.
     //
-    void AddData(const char* name, type_code type, void* data, ulong size)
+    void AddData(const Atom& name, type_code type, void* data, ulong size)
     { m_infoList.Append(new DataInfo(name, type, data, size)); }
 
     //
     //  Fuegt dem Message-Objekt einen bool-Wert hinzu.
     //
-    void AddBool(const char* name, bool b)
+    void AddBool(const Atom& name, bool b)
     { m_infoList.Append(new DataInfo(name, BOOL_TYPE, &b, sizeof(b))); }
 
     //
     //  Fuegt dem Message-Objekt einen char-Wert hinzu.
     //
-    void AddChar(const char* name, char c)
+    void AddChar(const Atom& name, char c)
     { m_infoList.Append(new DataInfo(name, CHAR_TYPE, &c, sizeof(c))); }
 
     //
     //  Fuegt dem Message-Objekt einen short-Wert hinzu.
     //
-    void AddShort(const char* name, short x)
+    void AddShort(const Atom& name, short x)
     { m_infoList.Append(new DataInfo(name, SHORT_TYPE, &x, sizeof(x))); }
 
     //
     //  Fuegt dem Message-Objekt einen int-Wert hinzu.
     //
-    void AddInt(const char* name, int x)
+    void AddInt(const Atom& name, int x)
     { m_infoList.Append(new DataInfo(name, INT_TYPE, &x, sizeof(x))); }
 
     //
     //  Fuegt dem Message-Objekt einen long-Wert hinzu.
     //
-    void AddLong(const char* name, long x)
+    void AddLong(const Atom& name, long x)
     { m_infoList.Append(new DataInfo(name, LONG_TYPE, &x, sizeof(x))); }
 
     //
     //  Fuegt dem Message-Objekt einen float-Wert hinzu.
     //
-    void AddFloat(const char* name, float x)
+    void AddFloat(const Atom& name, float x)
     { m_infoList.Append(new DataInfo(name, FLOAT_TYPE, &x, sizeof(x))); }
 
     //
     //  Fuegt dem Message-Objekt einen double-Wert hinzu.
     //
-    void AddDouble(const char* name, double x)
+    void AddDouble(const Atom& name, double x)
     { m_infoList.Append(new DataInfo(name, DOUBLE_TYPE, &x, sizeof(x))); }
 
     //
     //  Fuegt dem Message-Objekt einen Zeiger hinzu. Dabei wird nur der Zeiger
     //  selbst kopiert, nicht die Daten, auf die er verweist.
     //
-    void AddPointer(const char* name, void* p)
+    void AddPointer(const Atom& name, void* p)
     { m_infoList.Append(new DataInfo(name, POINTER_TYPE, &p, sizeof(p))); }
 
     //
@@ -214,26 +253,26 @@ public:
     //  Zeichenkette selbst, inklusive des abschliessenden Null-Zeichens,
     //  kopiert.
     //
-    void AddString(const char* name, const char* s)
+    void AddString(const Atom& name, const char* s)
     { m_infoList.Append(new DataInfo(name, STRING_TYPE, s,
                                     sizeof(char) * (strlen(s) + 1))); }
 
     //
     //  Fuegt dem Message-Objekt einen Point-Wert hinzu.
     //
-    void AddPoint(const char* name, const Point& p)
+    void AddPoint(const Atom& name, const Point& p)
     { m_infoList.Append(new DataInfo(name, POINT_TYPE, &p, sizeof(p))); }
 
     //
     //  Fuegt dem Message-Objekt einen Size-Wert hinzu.
     //
-    void AddSize(const char* name, const Size& s)
+    void AddSize(const Atom& name, const Size& s)
     { m_infoList.Append(new DataInfo(name, SIZE_TYPE, &s, sizeof(s))); }
 
     //
     //  Fuegt dem Message-Objekt einen Rect-Wert hinzu.
     //
-    void AddRect(const char* name, const Rect& r)
+    void AddRect(const Atom& name, const Rect& r)
     { m_infoList.Append(new DataInfo(name, RECT_TYPE, &r, sizeof(r))); }
 
     //
@@ -241,7 +280,7 @@ public:
     //  durch type, data und size spezifizierten. Die alten Daten werden
     //  geloescht.
     //
-    bool ReplaceData(const char* name, type_code type, void* data,
+    bool ReplaceData(const AtomLookup& name, type_code type, void* data,
                      ulong size);
 
     //
@@ -254,7 +293,7 @@ public:
     //  Die Funktion liefert true, wenn ein entsprechender Eintrag gefunden
     //  wurde, sonst false. Nur im true-Fall sind data und size gueltig.
     //
-    bool FindData(const char* name, type_code type, void** data,
+    bool FindData(const AtomLookup& name, type_code type, void** data,
                   ulong* size = nullptr) const;
 
     //
@@ -263,7 +302,7 @@ public:
     //  diesem Fall zeigt bp auf diesen Wert. Enthaelt das Message-Objekt
     //  keinen solchen Eintrag, liefert sie false.
     //
-    bool FindBool(const char* name, bool* bp) const;
+    bool FindBool(const AtomLookup& name, bool* bp) const;
 
     //
     //  Sucht nach dem ersten char-Eintrag unter dem Bezeichner name.  Die
@@ -271,7 +310,7 @@ public:
     //  diesem Fall zeigt cp auf diesen Wert. Enthaelt das Message-Objekt
     //  keinen solchen Eintrag, liefert sie false.
     //
-    bool FindChar(const char* name, char* cp) const;
+    bool FindChar(const AtomLookup& name, char* cp) const;
 
     //
     //  Sucht nach dem ersten short-Eintrag unter dem Bezeichner name.  Die
@@ -279,7 +318,7 @@ public:
     //  diesem Fall zeigt xp auf diesen Wert. Enthaelt das Message-Objekt
     //  keinen solchen Eintrag, liefert sie false.
     //
-    bool FindShort(const char* name, short* xp) const;
+    bool FindShort(const AtomLookup& name, short* xp) const;
 
     //
     //  Sucht nach dem ersten int-Eintrag unter dem Bezeichner name.  Die
@@ -287,7 +326,7 @@ public:
     //  diesem Fall zeigt xp auf diesen Wert. Enthaelt das Message-Objekt
     //  keinen solchen Eintrag, liefert sie false.
     //
-    bool FindInt(const char* name, int* xp) const;
+    bool FindInt(const AtomLookup& name, int* xp) const;
 
     //
     //  Sucht nach dem ersten long-Eintrag unter dem Bezeichner name.  Die
@@ -295,7 +334,7 @@ public:
     //  diesem Fall zeigt xp auf diesen Wert. Enthaelt das Message-Objekt
     //  keinen solchen Eintrag, liefert sie false.
     //
-    bool FindLong(const char* name, long* xp) const;
+    bool FindLong(const AtomLookup& name, long* xp) const;
 
     //
     //  Sucht nach dem ersten float-Eintrag unter dem Bezeichner name.  Die
@@ -303,7 +342,7 @@ public:
     //  diesem Fall zeigt xp auf diesen Wert. Enthaelt das Message-Objekt
     //  keinen solchen Eintrag, liefert sie false.
     //
-    bool FindFloat(const char* name, float* xp) const;
+    bool FindFloat(const AtomLookup& name, float* xp) const;
 
     //
     //  Sucht nach dem ersten double-Eintrag unter dem Bezeichner name.  Die
@@ -311,7 +350,7 @@ public:
     //  diesem Fall zeigt xp diesen Wert. Enthaelt das Message-Objekt keinen
     //  solchen Eintrag, liefert sie false.
     //
-    bool FindDouble(const char* name, double* xp) const;
+    bool FindDouble(const AtomLookup& name, double* xp) const;
 
     //
     //  Sucht nach dem ersten Zeiger-Eintrag unter dem Bezeichner name.  Die
@@ -319,7 +358,7 @@ public:
     //  diesem Fall zeigt pp auf diesen Wert. Enthaelt das Message-Objekt
     //  keinen solchen Eintrag, liefert sie false.
     //
-    bool FindPointer(const char* name, void** pp) const;
+    bool FindPointer(const AtomLookup& name, void** pp) const;
 
     //
     //  Sucht nach dem ersten Zeichenketten-Eintrag unter dem Bezeichner name.
@@ -327,7 +366,7 @@ public:
     //  diesem Fall zeigt sp auf die Zeichenkette. Enthaelt das Message-
     //  Objekt keinen solchen Eintrag, liefert sie false.
     //
-    bool FindString(const char* name, const char** sp) const;
+    bool FindString(const AtomLookup& name, const char** sp) const;
 
     //
     //  Sucht nach dem ersten Point-Eintrag unter dem Bezeichner name.  Die
@@ -335,7 +374,7 @@ public:
     //  diesem Fall zeigt pp auf dieses Point-Objekt. Enthaelt das Message-
     //  Objekt keinen solchen Eintrag, liefert sie false.
     //
-    bool FindPoint(const char* name, Point* pp) const;
+    bool FindPoint(const AtomLookup& name, Point* pp) const;
 
     //
     //  Sucht nach dem ersten Size-Eintrag unter dem Bezeichner name.  Die
@@ -343,7 +382,7 @@ public:
     //  diesem Fall zeigt sp auf dieses Size-Objekt. Enthaelt das Message-
     //  Objekt keinen solchen Eintrag, liefert sie false.
     //
-    bool FindSize(const char* name, Size* sp) const;
+    bool FindSize(const AtomLookup& name, Size* sp) const;
 
     //
     //  Sucht nach dem ersten Rect-Eintrag unter dem Bezeichner name.  Die
@@ -351,13 +390,13 @@ public:
     //  diesem Fall zeigt rp auf dieses Rect-Objekt. Enthaelt das Message-
     //  Objekt keinen solchen Eintrag, liefert sie false.
     //
-    bool FindRect(const char* name, Rect* rp) const;
+    bool FindRect(const AtomLookup& name, Rect* rp) const;
 
     //
     //  Entfernt alle unter dem Bezeichner name eingetragenen Daten aus dem
     //  Message-Objekt und gibt den dafuer reservierten Speicher wieder frei.
     //
-    bool RemoveName(const char* name);
+    bool RemoveName(const AtomLookup& name);
 
     //
     //  Entfernt alle in dem Message-Objekt eingetragenen Daten und gibt den
@@ -380,7 +419,7 @@ private:
 
     struct DataInfo
     {
-        DataInfo(const char* name, type_code type,
+        DataInfo(const Atom& name, type_code type,
                  const void* data, ulong size)
         { Init(name, type, data, size); }
 
@@ -388,27 +427,23 @@ private:
         { Init(info.name, info.type, info.data, info.size); }
 
         ~DataInfo()
-        {
-            delete[] name;
-            delete[] data;
-        }
+        { delete[] data; }
 
         DataInfo& operator=(const DataInfo& info)
         {
-            delete[] name;
             delete[] data;
 
             Init(info.name, info.type, info.data, info.size);
             return *this;
         }
 
-        bool operator==(const char* name) const
-        { return strcmp(this->name, name); }
+        bool operator==(const Atom& name) const
+        { return this->name == name; }
 
-        void Init(const char* name, type_code type,
+        void Init(const Atom& name, type_code type,
                   const void* data, ulong size);
 
-        char*       name;
+        Atom        name;
         type_code   type;
         char*       data;
         ulong       size;
@@ -419,15 +454,17 @@ private:
     //  beginnend bei pos. Ist name nicht enthalten, wird m_infoList.End()
     //  zurueckgeliefert.
     //
-    uint Locate(const char* name, uint pos = 0) const;
+    uint Locate(const Atom& name, uint pos = 0) const;
+
+    typedef SmallVector<DataInfo, 4, ExclusiveOwnership<DataInfo> > InfoList;
 
-    ::Handler*          m_handler;
-    Vector<DataInfo>    m_infoList;
+    ::Handler*  m_handler;
+    InfoList    m_infoList;
 };
 
 //----------------------------------------------------------------------------
 
-inline bool Message::FindBool(const char* name, bool* bp) const
+inline bool Message::FindBool(const AtomLookup& name, bool* bp) const
 {
     bool found;
     bool* data;
@@ -440,7 +477,7 @@ inline bool Message::FindBool(const char* name, bool* bp) const
 
 //----------------------------------------------------------------------------
 
-inline bool Message::FindChar(const char* name, char* cp) const
+inline bool Message::FindChar(const AtomLookup& name, char* cp) const
 {
     bool found;
     char* data;
@@ -453,7 +490,7 @@ inline bool Message::FindChar(const char* name, char* cp) const
 
 //----------------------------------------------------------------------------
 
-inline bool Message::FindShort(const char* name, short* xp) const
+inline bool Message::FindShort(const AtomLookup& name, short* xp) const
 {
     bool found;
     short* data;
@@ -466,7 +503,7 @@ inline bool Message::FindShort(const char* name, short* xp) const
 
 //----------------------------------------------------------------------------
 
-inline bool Message::FindInt(const char* name, int* xp) const
+inline bool Message::FindInt(const AtomLookup& name, int* xp) const
 {
     bool found;
     int* data;
@@ -479,7 +516,7 @@ inline bool Message::FindInt(const char* name, int* xp) const
 
 //----------------------------------------------------------------------------
 
-inline bool Message::FindLong(const char* name, long* xp) const
+inline bool Message::FindLong(const AtomLookup& name, long* xp) const
 {
     bool found;
     long* data;
@@ -492,7 +529,7 @@ inline bool Message::FindLong(const char* name, long* xp) const
 
 //----------------------------------------------------------------------------
 
-inline bool Message::FindFloat(const char* name, float* xp) const
+inline bool Message::FindFloat(const AtomLookup& name, float* xp) const
 {
     bool found;
     float* data;
@@ -505,7 +542,7 @@ inline bool Message::FindFloat(const char* name, float* xp) const
 
 //----------------------------------------------------------------------------
 
-inline bool Message::FindDouble(const char* name, double* xp) const
+inline bool Message::FindDouble(const AtomLookup& name, double* xp) const
 {
     bool found;
     double* data;
@@ -518,7 +555,7 @@ inline bool Message::FindDouble(const char* name, double* xp) const
 
 //----------------------------------------------------------------------------
 
-inline bool Message::FindPointer(const char* name, void** pp) const
+inline bool Message::FindPointer(const AtomLookup& name, void** pp) const
 {
     bool found;
     void** data;
@@ -531,7 +568,7 @@ inline bool Message::FindPointer(const char* name, void** pp) const
 
 //----------------------------------------------------------------------------
 
-inline bool Message::FindString(const char* name, const char** sp) const
+inline bool Message::FindString(const AtomLookup& name, const char** sp) const
 {
     bool found;
     char** data;
@@ -544,7 +581,7 @@ inline bool Message::FindString(const char* name, const char** sp) const
 
 //----------------------------------------------------------------------------
 
-inline bool Message::FindPoint(const char* name, Point* pp) const
+inline bool Message::FindPoint(const AtomLookup& name, Point* pp) const
 {
     bool found;
     Point* data;
@@ -557,7 +594,7 @@ inline bool Message::FindPoint(const char* name, Point* pp) const
 
 //----------------------------------------------------------------------------
 
-inline bool Message::FindSize(const char* name, Size* sp) const
+inline bool Message::FindSize(const AtomLookup& name, Size* sp) const
 {
     bool found;
     Size* data;
@@ -570,7 +607,7 @@ inline bool Message::FindSize(const char* name, Size* sp) const
 
 //----------------------------------------------------------------------------
 
-inline bool Message::FindRect(const char* name, Rect* rp) const
+inline bool Message::FindRect(const AtomLookup& name, Rect* rp) const
 {
     bool found;
     Rect* data;
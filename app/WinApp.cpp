@@ -126,22 +126,22 @@ void WinApp::CreateMouseMessage(UINT msg, WPARAM wParam, LPARAM lParam,
     {
     case WM_LBUTTONDOWN:
         message->what = MSG_MOUSE_DOWN;
-        message->AddInt("button", LEFT_BUTTON);
+        message->AddInt(FIELD_BUTTON, LEFT_BUTTON);
         break;
 
     case WM_RBUTTONDOWN:
         message->what = MSG_MOUSE_DOWN;
-        message->AddInt("button", RIGHT_BUTTON);
+        message->AddInt(FIELD_BUTTON, RIGHT_BUTTON);
         break;
 
     case WM_LBUTTONUP:
         message->what = MSG_MOUSE_UP;
-        message->AddInt("button", LEFT_BUTTON);
+        message->AddInt(FIELD_BUTTON, LEFT_BUTTON);
         break;
 
     case WM_RBUTTONUP:
         message->what = MSG_MOUSE_UP;
-        message->AddInt("button", RIGHT_BUTTON);
+        message->AddInt(FIELD_BUTTON, RIGHT_BUTTON);
         break;
 
     case WM_MOUSEMOVE:
@@ -150,12 +150,12 @@ void WinApp::CreateMouseMessage(UINT msg, WPARAM wParam, LPARAM lParam,
 
     case WM_LBUTTONDBLCLK:
         message->what = MSG_MOUSE_DOUBLECLICK;
-        message->AddInt("button", LEFT_BUTTON);
+        message->AddInt(FIELD_BUTTON, LEFT_BUTTON);
         break;
 
     case WM_RBUTTONDBLCLK:
         message->what = MSG_MOUSE_DOUBLECLICK;
-        message->AddInt("button", RIGHT_BUTTON);
+        message->AddInt(FIELD_BUTTON, RIGHT_BUTTON);
         break;
 
     default:
@@ -174,9 +174,9 @@ void WinApp::CreateMouseMessage(UINT msg, WPARAM wParam, LPARAM lParam,
     if ((fwKeys & MK_SHIFT) != 0)
         keyState = (keyState | SHIFT_DOWN);
 
-    message->AddInt("keys", keyState);
-    message->AddInt("xpos", LOWORD(lParam));
-    message->AddInt("ypos", HIWORD(lParam));
+    message->AddInt(FIELD_KEYS, keyState);
+    message->AddInt(FIELD_XPOS, LOWORD(lParam));
+    message->AddInt(FIELD_YPOS, HIWORD(lParam));
 }
 
 //----------------------------------------------------------------------------
@@ -202,22 +202,22 @@ LRESULT CALLBACK WinApp::WindowProc(HWND hWindow, UINT msg,
 
     case WM_KEYDOWN:
         message.what = MSG_KEY_DOWN;
-        message.AddInt("key", (int) wParam);
+        message.AddInt(FIELD_KEY, (int) wParam);
         break;
 
     case WM_KEYUP:
         message.what = MSG_KEY_UP;
-        message.AddInt("key", (int) wParam);
+        message.AddInt(FIELD_KEY, (int) wParam);
         break;
 
     case WM_CHAR:
         message.what = MSG_KEY_PRESSED;
-        message.AddInt("char", (int) wParam);
+        message.AddInt(FIELD_CHAR, (int) wParam);
         break;
 
     case WM_TIMER:
         message.what = MSG_PULSE;
-        message.AddInt("timer", wParam);
+        message.AddInt(FIELD_TIMER, wParam);
         break;
 
     case WM_PAINT:
@@ -226,29 +226,29 @@ LRESULT CALLBACK WinApp::WindowProc(HWND hWindow, UINT msg,
 
     case WM_COMMAND:
         message.what = MSG_COMMAND;
-        message.AddInt("cmd", LOWORD(wParam));
+        message.AddInt(FIELD_COMMAND, LOWORD(wParam));
         break;
 
     case WM_SETFOCUS:
         message.what = MSG_VIEW_FOCUS_CHANGED;
-        message.AddBool("focused", true);
+        message.AddBool(FIELD_FOCUSED, true);
         break;
 
     case WM_KILLFOCUS:
         message.what = MSG_VIEW_FOCUS_CHANGED;
-        message.AddBool("focused", false);
+        message.AddBool(FIELD_FOCUSED, false);
         break;
 
     case WM_SIZE:
         message.what = MSG_VIEW_RESIZED;
-        message.AddInt("width",  LOWORD(lParam));
-        message.AddInt("height", HIWORD(lParam));
+        message.AddInt(FIELD_WIDTH,  LOWORD(lParam));
+        message.AddInt(FIELD_HEIGHT, HIWORD(lParam));
         break;
 
     case WM_MOVE:
         message.what = MSG_VIEW_MOVED;
-        message.AddInt("xpos", (int) LOWORD(lParam));
-        message.AddInt("ypos", (int) HIWORD(lParam));
+        message.AddInt(FIELD_XPOS, (int) LOWORD(lParam));
+        message.AddInt(FIELD_YPOS, (int) HIWORD(lParam));
         break;
 
     case WM_CLOSE:
@@ -257,17 +257,17 @@ LRESULT CALLBACK WinApp::WindowProc(HWND hWindow, UINT msg,
 
     case WM_ACTIVATE:
         message.what = MSG_WINDOW_ACTIVATED;
-        message.AddBool("active", LOWORD(wParam) != WA_INACTIVE);
+        message.AddBool(FIELD_ACTIVE, LOWORD(wParam) != WA_INACTIVE);
         break;
 
     case WM_SHOWWINDOW:
         message.what = MSG_VIEW_VISIBILITY_CHANGED;
-        message.AddBool("show", (BOOL) wParam == TRUE);
+        message.AddBool(FIELD_SHOW, (BOOL) wParam == TRUE);
         break;
 
     case WM_ENABLE:
         message.what = MSG_VIEW_ENABLED;
-        message.AddBool("enabled", (BOOL) wParam == TRUE);
+        message.AddBool(FIELD_ENABLED, (BOOL) wParam == TRUE);
         break;
 
     default:
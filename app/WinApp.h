@@ -4,7 +4,7 @@
 #include "app/Application.h"
 #include "app/WinResourceLoader.h"
 #include "platform/Win.h"
-#include "support/Dict.h"
+#include "support/ConcurrentDict.h"
 
 //----------------------------------------------------------------------------
 //
@@ -51,7 +51,7 @@ public:
     //  kein solcher Handler registriert wurde.
     //
     Handler* GetMessageHandler(HWND hWindow)
-    { m_messageHandlers[hWindow]; }
+    { return m_messageHandlers[hWindow]; }
 
     //
     //  Entfernt die Registrierung des zu hWindow gehoerenden Handlers.
@@ -98,11 +98,14 @@ private:
 
     bool RegisterWindowClass();
 
+    typedef ConcurrentDict<HWND, Handler, DefaultHash<HWND>,
+                           SharedOwnership<Handler> > HandlerDict;
+
     bool                m_quit;
     HINSTANCE           m_hInstance;
     LPSTR               m_cmdLine;
     int                 m_cmdShow;
-    Dict<HWND, Handler> m_messageHandlers;
+    HandlerDict         m_messageHandlers;
     WinResourceLoader   m_resourceLoader;
 };
 
@@ -0,0 +1,134 @@
+#include "bench/Bench.h"
+#include "support/Array.h"
+#include "support/Collection.h"
+#include "support/Vector.h"
+
+//----------------------------------------------------------------------------
+//
+//  Vergleicht Array mit Vector beim Anhaengen, Durchlaufen und Suchen.
+//
+//  Ein Vector speichert jedes Element in einem eigenen Objekt auf dem Heap,
+//  ein Array alle Elemente hintereinander. Fuer jede Groesse n werden n
+//  Elemente an einen leeren Container angehaengt (einschliesslich seiner
+//  Zerstoerung), alle Elemente durchlaufen und das Element in der Mitte
+//  gesucht. Jede Messung wird so oft wiederholt, dass sie mindestens
+//  MIN_OPERATIONS Elemente umfasst. Angegeben wird die Dauer je
+//  angehaengtem, durchlaufenem bzw. verglichenem Element.
+//
+
+volatile uint bench_sink;
+
+static const uint MIN_OPERATIONS = 10000000;
+
+//----------------------------------------------------------------------------
+//
+//  Element in der Groesse eines kleinen Datensatzes, z.B. Message::DataInfo.
+//
+struct BenchItem
+{
+    BenchItem(uint key)
+        : key(key), a(0), b(0), c(0) {}
+
+    bool operator==(const BenchItem& item) const
+    { return key == item.key; }
+
+    uint    key;
+    uint    a;
+    uint    b;
+    uint    c;
+};
+
+typedef Array<BenchItem>                                 ItemArray;
+typedef Vector<BenchItem, ExclusiveOwnership<BenchItem> > ItemVector;
+
+//----------------------------------------------------------------------------
+//
+//  Einheitlicher Zugriff auf die beiden Container.
+//
+static void Append(ItemArray& array, uint key)
+{ array.Emplace(key); }
+
+static uint KeyAt(const ItemArray& array, uint pos)
+{ return array[pos].key; }
+
+static void Append(ItemVector& vector, uint key)
+{ vector.Append(new BenchItem(key)); }
+
+static uint KeyAt(const ItemVector& vector, uint pos)
+{ return vector[pos]->key; }
+
+//----------------------------------------------------------------------------
+
+template <class Container>
+static void BenchContainer(const char* name, uint count)
+{
+    uint rounds = Max(MIN_OPERATIONS / count, 1u);
+    uint finds = Max(MIN_OPERATIONS / (count / 2 + 1), 1u);
+    uint sum = 0;
+
+    BenchTimer append_timer;
+
+    for (uint round = 0; round < rounds; ++round)
+    {
+        Container container;
+
+        for (uint i = 0; i < count; ++i)
+            Append(container, i);
+
+        sum += container.Count();
+    }
+
+    double append_time = append_timer.Seconds();
+
+    Container container;
+
+    for (uint i = 0; i < count; ++i)
+        Append(container, i);
+
+    BenchTimer iterate_timer;
+
+    for (uint round = 0; round < rounds; ++round)
+    {
+        for (uint i = 0; i < container.Count(); ++i)
+            sum += KeyAt(container, i);
+    }
+
+    double iterate_time = iterate_timer.Seconds();
+
+    BenchTimer find_timer;
+
+    for (uint i = 0; i < finds; ++i)
+        sum += container.Find(BenchItem(count / 2));
+
+    double find_time = find_timer.Seconds();
+
+    bench_sink = sum;
+
+    char label[64];
+
+    sprintf(label, "%s append, n = %u", name, count);
+    BenchReport(label, rounds * count, append_time);
+
+    sprintf(label, "%s iterate, n = %u", name, count);
+    BenchReport(label, rounds * count, iterate_time);
+
+    sprintf(label, "%s Find(), n = %u", name, count);
+    BenchReport(label, finds * (count / 2 + 1), find_time);
+}
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    static const uint counts[] = { 1000, 10000, 100000, 1000000 };
+
+    for (uint i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+    {
+        BenchContainer<ItemVector>("Vector", counts[i]);
+        BenchContainer<ItemArray>("Array", counts[i]);
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------
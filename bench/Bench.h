@@ -0,0 +1,133 @@
+#ifndef bench_Bench_h
+#define bench_Bench_h
+
+#include "support/Utilities.h"
+
+#include <cstdio>
+#include <ctime>
+#include <x86intrin.h>
+
+#ifdef _WIN32
+#include "platform/Win.h"
+#else
+#include <pthread.h>
+#endif
+
+//----------------------------------------------------------------------------
+//
+//  Hilfsmittel fuer die Benchmark-Programme in bench/.
+//
+//  Die Programme werden mit "make bench" bzw. "make -C bench run" erzeugt
+//  und ausgefuehrt. Gemessen wird mit clock(); jeder Messlauf sollte
+//  deshalb mindestens einige zehn Millisekunden dauern.
+//
+
+//----------------------------------------------------------------------------
+//
+//  Misst die seit der Erzeugung vergangene Zeit.
+//
+class BenchTimer
+{
+public:
+
+    BenchTimer()
+        : m_start(clock()) {}
+
+    double Seconds() const
+    { return double(clock() - m_start) / CLOCKS_PER_SEC; }
+
+private:
+
+    clock_t m_start;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Liefert den Stand des Taktzaehlers des Prozessors. Damit lassen sich
+//  einzelne Operationen messen, fuer die clock() viel zu grob ist; das
+//  Ergebnis sind Takte, keine Nanosekunden.
+//
+inline ulonglong BenchCycles()
+{ return __rdtsc(); }
+
+//----------------------------------------------------------------------------
+//
+//  Gibt das Ergebnis eines Messlaufs aus: die Zahl der Operationen und die
+//  mittlere Dauer einer Operation in Nanosekunden.
+//
+inline void BenchReport(const char* name, uint operations, double seconds)
+{
+    printf("%-44s %9u ops %10.1f ns/op\n", name, operations,
+           operations > 0 ? seconds * 1e9 / operations : 0.0);
+}
+
+//----------------------------------------------------------------------------
+//
+//  Fuehrt fn(arg) in einem eigenen Thread aus. Der Destruktor wartet, bis
+//  der Thread beendet ist.
+//
+class BenchThread
+{
+public:
+
+    typedef void (*Function)(void* arg);
+
+    BenchThread(Function fn, void* arg)
+        : m_fn(fn), m_arg(arg)
+    {
+#ifdef _WIN32
+        m_thread = CreateThread(nullptr, 0, Start, this, 0, nullptr);
+#else
+        pthread_create(&m_thread, nullptr, Start, this);
+#endif
+    }
+
+    ~BenchThread()
+    {
+#ifdef _WIN32
+        WaitForSingleObject(m_thread, INFINITE);
+        CloseHandle(m_thread);
+#else
+        pthread_join(m_thread, nullptr);
+#endif
+    }
+
+private:
+
+    BenchThread(const BenchThread&);
+    BenchThread& operator=(const BenchThread&);
+
+#ifdef _WIN32
+    static DWORD WINAPI Start(void* self)
+    {
+        static_cast<BenchThread*>(self)->m_fn(
+            static_cast<BenchThread*>(self)->m_arg);
+        return 0;
+    }
+
+    HANDLE      m_thread;
+#else
+    static void* Start(void* self)
+    {
+        static_cast<BenchThread*>(self)->m_fn(
+            static_cast<BenchThread*>(self)->m_arg);
+        return nullptr;
+    }
+
+    pthread_t   m_thread;
+#endif
+
+    Function    m_fn;
+    void*       m_arg;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Nimmt Ergebnisse der gemessenen Schleifen auf, damit der Compiler sie
+//  nicht wegoptimiert.
+//
+extern volatile uint bench_sink;
+
+//----------------------------------------------------------------------------
+
+#endif
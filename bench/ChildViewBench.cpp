@@ -0,0 +1,143 @@
+#include "bench/Bench.h"
+#include "support/Collection.h"
+#include "support/SmallVector.h"
+
+//----------------------------------------------------------------------------
+//
+//  Misst das Abbauen eines Fensters mit vielen Kind-Views.
+//
+//  Jeder View entfernt sich in seinem Destruktor mit Container::RemoveChild()
+//  aus der Kindliste seines Containers, die ihn dazu mit FindRef() sucht.
+//  Nachgebildet wird nur die Kindliste, weil jeder echte View ein Fenster
+//  des Betriebssystems anlegt, dessen Kosten die Messung ueberdecken
+//  wuerden; zudem begrenzt Windows die Zahl der Fenster eines Prozesses auf
+//  10000. Die Views werden in umgekehrter Reihenfolge (jede Suche laeuft
+//  ueber die ganze Liste) und in zufaelliger Reihenfolge entfernt.
+//
+//  Zum Vergleich wird die fruehere Suche nachgebildet, eine einfache
+//  Schleife ueber die Zeiger.
+//
+
+volatile uint bench_sink;
+
+static const uint MIN_OPERATIONS = 100000;
+
+static uint _random = 2463534242u;
+
+//----------------------------------------------------------------------------
+
+static uint Random(uint range)
+{
+    _random ^= _random << 13;
+    _random ^= _random >> 17;
+    _random ^= _random << 5;
+
+    return _random % range;
+}
+
+//----------------------------------------------------------------------------
+
+struct BenchView
+{
+    uint id;
+};
+
+typedef SmallVector<BenchView, 8, SharedOwnership<BenchView> > ChildList;
+
+//----------------------------------------------------------------------------
+//
+//  Container::RemoveChild() mit der vektorisierten bzw. der frueheren
+//  Suche.
+//
+static void RemoveChild(ChildList& list, BenchView* view)
+{
+    uint pos = list.FindRef(view);
+
+    if (pos != list.End())
+        list.Remove(pos);
+}
+
+static void RemoveChildScalar(ChildList& list, BenchView* view)
+{
+    uint pos;
+
+    for (pos = 0; pos < list.Count(); ++pos)
+    {
+        if (list[pos] == view)
+            break;
+    }
+
+    if (pos != list.End())
+        list.Remove(pos);
+}
+
+//----------------------------------------------------------------------------
+
+static void BenchTeardown(const char* name,
+                          void (*remove)(ChildList&, BenchView*),
+                          uint count, bool random)
+{
+    uint rounds = Max(MIN_OPERATIONS / count, 1u);
+    BenchView* views = new BenchView[count];
+    ChildList* lists = new ChildList[rounds];
+    uint* order = new uint[rounds * count];
+
+    for (uint round = 0; round < rounds; ++round)
+    {
+        uint* round_order = order + round * count;
+
+        for (uint i = 0; i < count; ++i)
+        {
+            lists[round].Append(&views[i]);
+            round_order[i] = count - 1 - i;
+        }
+
+        for (uint i = count; random && i > 1; --i)
+            Swap(round_order[i - 1], round_order[Random(i)]);
+    }
+
+    BenchTimer timer;
+
+    for (uint round = 0; round < rounds; ++round)
+    {
+        const uint* round_order = order + round * count;
+
+        for (uint i = 0; i < count; ++i)
+            remove(lists[round], &views[round_order[i]]);
+
+        bench_sink = lists[round].Count();
+    }
+
+    double seconds = timer.Seconds();
+
+    char label[64];
+
+    sprintf(label, "%s, %s, n = %u", name, random ? "random" : "reverse",
+            count);
+    BenchReport(label, rounds * count, seconds);
+
+    delete[] order;
+    delete[] lists;
+    delete[] views;
+}
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    static const uint counts[] = { 1000, 5000, 20000 };
+
+    for (uint i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+    {
+        for (uint random = 0; random < 2; ++random)
+        {
+            BenchTeardown("Scalar loop", RemoveChildScalar, counts[i],
+                          random != 0);
+            BenchTeardown("FindRef()", RemoveChild, counts[i], random != 0);
+        }
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------
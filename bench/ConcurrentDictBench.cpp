@@ -0,0 +1,171 @@
+#include "bench/Bench.h"
+#include "support/Atomic.h"
+#include "support/Collection.h"
+#include "support/ConcurrentDict.h"
+#include "support/HashTable.h"
+#include "support/Lock.h"
+
+//----------------------------------------------------------------------------
+//
+//  Misst Suchen in einer ConcurrentDict, waehrend ein anderer Thread
+//  staendig Eintraege einfuegt und entfernt.
+//
+//  Die Tabelle enthaelt KEY_COUNT Eintraege. READER_COUNT Threads suchen
+//  jeweils LOOKUP_COUNT zufaellige, vorhandene Schluessel; ein weiterer
+//  Thread fuegt so lange andere Schluessel ein und entfernt sie wieder, bis
+//  alle Leser fertig sind. Zum Vergleich dient eine einzelne HashTable, die
+//  durch eine einzige ReadWriteLock geschuetzt ist.
+//
+//  Angegeben wird die gesamte Dauer geteilt durch die Zahl aller Suchen
+//  und die Zahl der Aenderungen, die der schreibende Thread in dieser Zeit
+//  geschafft hat. Unter Windows misst clock() die verstrichene Zeit; auf
+//  Systemen, auf denen clock() die Rechenzeit aller Threads addiert, sind
+//  die Ergebnisse nur mit einem Prozessor vergleichbar.
+//
+
+volatile uint bench_sink;
+
+static const uint KEY_COUNT = 10000;
+static const uint READER_COUNT = 8;
+static const uint LOOKUP_COUNT = 2000000;
+
+static int _item;
+
+typedef ConcurrentDict<uint, int, DefaultHash<uint>,
+                       SharedOwnership<int> > UintConcurrentDict;
+
+typedef HashTable<uint, int, DefaultHash<uint>,
+                  SharedOwnership<int> > UintHashTable;
+
+//----------------------------------------------------------------------------
+//
+//  HashTable mit einer einzigen Sperre.
+//
+class LockedHashTable
+{
+public:
+
+    bool Insert(uint key, int* data)
+    {
+        WriteLocker locker(m_lock);
+        return m_table.Insert(key, data);
+    }
+
+    int* Take(uint key)
+    {
+        WriteLocker locker(m_lock);
+        return m_table.Take(key);
+    }
+
+    int* Find(uint key)
+    {
+        ReadLocker locker(m_lock);
+        return m_table.Find(key);
+    }
+
+private:
+
+    ReadWriteLock   m_lock;
+    UintHashTable   m_table;
+};
+
+//----------------------------------------------------------------------------
+
+template <class Table>
+struct BenchState
+{
+    Table           table;
+    Atomic<uint>    readers;
+    Atomic<uint>    writes;
+    Atomic<uint>    found;
+};
+
+//----------------------------------------------------------------------------
+
+template <class Table>
+static void Reader(void* arg)
+{
+    BenchState<Table>* state = static_cast<BenchState<Table>*>(arg);
+    uint random = reinterpret_cast<size_t>(&random) | 1;
+    uint found = 0;
+
+    for (uint i = 0; i < LOOKUP_COUNT; ++i)
+    {
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+
+        found += state->table.Find(random % KEY_COUNT) != nullptr;
+    }
+
+    state->found.FetchAdd(found, MEMORY_ORDER_RELAXED);
+    state->readers.FetchSub(1, MEMORY_ORDER_RELEASE);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Table>
+static void Writer(void* arg)
+{
+    BenchState<Table>* state = static_cast<BenchState<Table>*>(arg);
+    uint writes = 0;
+
+    while (state->readers.Load(MEMORY_ORDER_ACQUIRE) != 0)
+    {
+        uint key = KEY_COUNT + writes % KEY_COUNT;
+
+        state->table.Insert(key, &_item);
+        state->table.Take(key);
+        writes += 2;
+    }
+
+    state->writes.Store(writes, MEMORY_ORDER_RELAXED);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Table>
+static void BenchTable(const char* name)
+{
+    BenchState<Table>* state = new BenchState<Table>;
+
+    for (uint i = 0; i < KEY_COUNT; ++i)
+        state->table.Insert(i, &_item);
+
+    state->readers.Store(READER_COUNT, MEMORY_ORDER_RELAXED);
+
+    BenchThread* threads[READER_COUNT + 1];
+    BenchTimer timer;
+
+    threads[READER_COUNT] = new BenchThread(Writer<Table>, state);
+
+    for (uint i = 0; i < READER_COUNT; ++i)
+        threads[i] = new BenchThread(Reader<Table>, state);
+
+    for (uint i = 0; i <= READER_COUNT; ++i)
+        delete threads[i];
+
+    double seconds = timer.Seconds();
+
+    bench_sink = state->found.Load(MEMORY_ORDER_RELAXED);
+
+    char label[64];
+
+    sprintf(label, "%s, %u readers", name, READER_COUNT);
+    BenchReport(label, READER_COUNT * LOOKUP_COUNT, seconds);
+    printf("    %u writes\n", state->writes.Load(MEMORY_ORDER_RELAXED));
+
+    delete state;
+}
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    BenchTable<LockedHashTable>("HashTable, one lock");
+    BenchTable<UintConcurrentDict>("ConcurrentDict");
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,142 @@
+#include "bench/Bench.h"
+#include "support/Collection.h"
+#include "support/Dict.h"
+#include "support/HashTable.h"
+
+#include <climits>
+#include <cstdlib>
+
+//----------------------------------------------------------------------------
+//
+//  Misst die Verteilung der Dauer einzelner Insert()-Aufrufe, waehrend eine
+//  Tabelle von klein auf INSERT_COUNT Eintraege waechst.
+//
+//  Ein Dict, dessen Groesse von Hand mit Resize() verdoppelt wird, sobald
+//  es voll ist, uebertraegt dabei alle Eintraege auf einmal; ebenso die
+//  HashTable. Ein Dict mit automatischer Groessenanpassung verteilt die
+//  Umstellung auf die folgenden Aufrufe, hoechstens maxWork Listen pro
+//  Aufruf. Angegeben werden Median, 99. und 99,9. Perzentil und Maximum in
+//  Takten des Prozessors.
+//
+
+volatile uint bench_sink;
+
+static const uint INSERT_COUNT = 1000000;
+
+static int _item;
+
+typedef Dict<uint, int, DefaultHash<uint>, SharedOwnership<int> > UintDict;
+
+typedef HashTable<uint, int, DefaultHash<uint>,
+                  SharedOwnership<int> > UintHashTable;
+
+//----------------------------------------------------------------------------
+
+static int CompareLatency(const void* a, const void* b)
+{
+    uint x = *static_cast<const uint*>(a);
+    uint y = *static_cast<const uint*>(b);
+
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+//----------------------------------------------------------------------------
+//
+//  Sortiert die gemessenen Dauern und gibt die Perzentile aus.
+//
+static void ReportLatency(const char* name, uint* latency, uint count)
+{
+    qsort(latency, count, sizeof(uint), CompareLatency);
+
+    printf("%-36s p50 %5u  p99 %6u  p99.9 %7u  max %9u cycles\n", name,
+           latency[count / 2], latency[count - count / 100],
+           latency[count - count / 1000], latency[count - 1]);
+}
+
+//----------------------------------------------------------------------------
+
+static uint Elapsed(ulonglong start)
+{
+    return uint(Min(BenchCycles() - start, ulonglong(UINT_MAX)));
+}
+
+//----------------------------------------------------------------------------
+
+static void BenchManualResize(uint* latency)
+{
+    UintDict dict;
+
+    for (uint i = 0; i < INSERT_COUNT; ++i)
+    {
+        ulonglong start = BenchCycles();
+
+        if (dict.Count() >= dict.Size())
+            dict.Resize(2 * dict.Size() + 1);
+
+        dict.Insert(i, &_item);
+        latency[i] = Elapsed(start);
+    }
+
+    bench_sink = dict.Count();
+    ReportLatency("Dict, Resize() when full", latency, INSERT_COUNT);
+}
+
+//----------------------------------------------------------------------------
+
+static void BenchAutoResize(uint* latency, uint maxWork)
+{
+    UintDict dict;
+
+    dict.SetAutoResize(true, maxWork);
+
+    for (uint i = 0; i < INSERT_COUNT; ++i)
+    {
+        ulonglong start = BenchCycles();
+
+        dict.Insert(i, &_item);
+        latency[i] = Elapsed(start);
+    }
+
+    bench_sink = dict.Count();
+
+    char label[64];
+
+    sprintf(label, "Dict, auto-resize, maxWork = %u", maxWork);
+    ReportLatency(label, latency, INSERT_COUNT);
+}
+
+//----------------------------------------------------------------------------
+
+static void BenchHashTable(uint* latency)
+{
+    UintHashTable table;
+
+    for (uint i = 0; i < INSERT_COUNT; ++i)
+    {
+        ulonglong start = BenchCycles();
+
+        table.Insert(i, &_item);
+        latency[i] = Elapsed(start);
+    }
+
+    bench_sink = table.Count();
+    ReportLatency("HashTable", latency, INSERT_COUNT);
+}
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    uint* latency = new uint[INSERT_COUNT];
+
+    BenchManualResize(latency);
+    BenchAutoResize(latency, 1);
+    BenchAutoResize(latency, UintDict::DEFAULT_RESIZE_WORK);
+    BenchAutoResize(latency, 16);
+    BenchHashTable(latency);
+
+    delete[] latency;
+    return 0;
+}
+
+//----------------------------------------------------------------------------
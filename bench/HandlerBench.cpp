@@ -0,0 +1,101 @@
+#include "bench/Bench.h"
+#include "app/Handler.h"
+#include "app/Looper.h"
+#include "support/Collection.h"
+#include "support/List.h"
+
+//----------------------------------------------------------------------------
+//
+//  Misst das Registrieren und Entfernen von Handlern, das jeder View in
+//  seinem Konstruktor und Destruktor ausfuehrt (TheApp->AddHandler() bzw.
+//  RemoveHandler()). Echte Views werden nicht erzeugt, weil jeder View ein
+//  Fenster des Betriebssystems anlegt und dessen Kosten die Messung
+//  ueberdecken wuerden; zudem begrenzt Windows die Zahl der Fenster eines
+//  Prozesses auf 10000.
+//
+//  Zum Vergleich wird die fruehere Handler-Liste des Loopers nachgebildet,
+//  eine List<Handler> mit Append() und RemoveRef().
+//
+
+volatile uint bench_sink;
+
+static const uint HANDLER_COUNT = 100000;
+
+//----------------------------------------------------------------------------
+
+class BenchHandler: public Handler
+{
+};
+
+class BenchLooper: public Looper
+{
+public:
+
+    void Run() {}
+    void Quit() {}
+};
+
+typedef List<Handler, SharedOwnership<Handler> > OldHandlerList;
+
+//----------------------------------------------------------------------------
+//
+//  Erzeugt und registriert HANDLER_COUNT Handler und zerstoert sie wieder,
+//  in der Reihenfolge der Erzeugung oder in umgekehrter Reihenfolge.
+//
+static void BenchLooperHandlers(const char* name, bool reverse)
+{
+    BenchLooper looper;
+    Handler** handlers = new Handler*[HANDLER_COUNT];
+    BenchTimer timer;
+
+    for (uint i = 0; i < HANDLER_COUNT; ++i)
+    {
+        handlers[i] = new BenchHandler;
+        looper.AddHandler(handlers[i]);
+    }
+
+    for (uint i = 0; i < HANDLER_COUNT; ++i)
+        delete handlers[reverse ? HANDLER_COUNT - 1 - i : i];
+
+    BenchReport(name, HANDLER_COUNT, timer.Seconds());
+    delete[] handlers;
+}
+
+//----------------------------------------------------------------------------
+
+static void BenchOldHandlers(const char* name, bool reverse)
+{
+    OldHandlerList list;
+    Handler** handlers = new Handler*[HANDLER_COUNT];
+    BenchTimer timer;
+
+    for (uint i = 0; i < HANDLER_COUNT; ++i)
+    {
+        handlers[i] = new BenchHandler;
+        list.Append(handlers[i]);
+    }
+
+    for (uint i = 0; i < HANDLER_COUNT; ++i)
+    {
+        Handler* handler = handlers[reverse ? HANDLER_COUNT - 1 - i : i];
+        bench_sink = list.RemoveRef(handler);
+        delete handler;
+    }
+
+    BenchReport(name, HANDLER_COUNT, timer.Seconds());
+    delete[] handlers;
+}
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    BenchOldHandlers("List<Handler>, destroy in creation order", false);
+    BenchOldHandlers("List<Handler>, destroy in reverse order", true);
+    BenchLooperHandlers("Looper, destroy in creation order", false);
+    BenchLooperHandlers("Looper, destroy in reverse order", true);
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,203 @@
+#include "bench/Bench.h"
+#include "support/Hash.h"
+
+#include <cstring>
+
+//----------------------------------------------------------------------------
+//
+//  Vergleicht die Hashfunktionen aus Hash.h mit dem byteweisen FNV-1a, das
+//  sie ersetzt haben.
+//
+//  Gemessen wird zuerst der Durchsatz von HashBuffer() fuer Schluessel
+//  verschiedener Laenge. Danach wird fuer typische Schluessel geprueft, wie
+//  gut sich die Hashwerte auf eine halb gefuellte Tabelle verteilen, deren
+//  Groesse eine Zweierpotenz ist und die wie HashTable nur die unteren Bits
+//  verwendet und linear sondiert. Angegeben wird die mittlere und die
+//  laengste Sondierungsfolge; bei guter Verteilung liegt der Mittelwert bei
+//  etwa 1,3.
+//
+
+volatile uint bench_sink;
+
+static const uint MIN_BYTES = 100000000;
+static const uint KEY_COUNT = 100000;
+
+//----------------------------------------------------------------------------
+//
+//  Die frueher verwendeten Hashfunktionen. Sie werden als Template-
+//  Argumente verwendet und muessen deshalb extern sichtbar sein.
+//
+uint FnvBuffer(const char* p, uint size)
+{
+    uint h = 2166136261u;
+
+    for (uint i = 0; i < size; ++i)
+        h = (h ^ *p++) * 16777619u;
+
+    return h;
+}
+
+uint FnvString(const char* p)
+{
+    uint h = 2166136261u;
+
+    while (*p != '\0')
+        h = (h ^ *p++) * 16777619u;
+
+    return h;
+}
+
+uint IdentityPointer(const void* p)
+{
+    return uint(reinterpret_cast<size_t>(p));
+}
+
+uint NewBuffer(const char* p, uint size)
+{
+    return HashBuffer(p, size);
+}
+
+uint NewString(const char* p)
+{
+    return HashString(p);
+}
+
+//----------------------------------------------------------------------------
+
+template <uint (*Fn)(const char*, uint)>
+static void BenchThroughput(const char* name, uint size)
+{
+    char* buffer = new char[size];
+
+    for (uint i = 0; i < size; ++i)
+        buffer[i] = char('a' + i % 26);
+
+    uint rounds = Max(MIN_BYTES / size, 1u);
+    uint sum = 0;
+    BenchTimer timer;
+
+    for (uint round = 0; round < rounds; ++round)
+    {
+        buffer[0] = char(round);
+        sum += Fn(buffer, size);
+    }
+
+    double seconds = timer.Seconds();
+
+    bench_sink = sum;
+
+    char label[64];
+
+    sprintf(label, "%s, %u bytes", name, size);
+    BenchReport(label, rounds, seconds);
+
+    delete[] buffer;
+}
+
+//----------------------------------------------------------------------------
+//
+//  Traegt die Hashwerte hashes in eine linear sondierte Tabelle ein und
+//  gibt die mittlere und die laengste Sondierungsfolge aus.
+//
+static void ReportProbes(const char* name, const uint* hashes, uint count)
+{
+    uint size = 1;
+
+    while (size < 2 * count)
+        size *= 2;
+
+    bool* used = new bool[size];
+    uint mask = size - 1;
+    uint total = 0;
+    uint longest = 0;
+
+    memset(used, 0, size);
+
+    for (uint i = 0; i < count; ++i)
+    {
+        uint index = hashes[i] & mask;
+        uint probes = 1;
+
+        while (used[index])
+        {
+            index = (index + 1) & mask;
+            ++probes;
+        }
+
+        used[index] = true;
+        total += probes;
+        longest = Max(longest, probes);
+    }
+
+    printf("%-36s mean %8.2f  longest %6u probes\n", name,
+           double(total) / count, longest);
+
+    delete[] used;
+}
+
+//----------------------------------------------------------------------------
+//
+//  Schluessel wie die Adressen von Fenstern bzw. anderen Objekten, die
+//  hintereinander im Speicher liegen.
+//
+static void BenchPointerQuality(uint* hashes)
+{
+    static const uint STRIDE = 64;
+
+    char* objects = new char[KEY_COUNT * STRIDE];
+
+    for (uint i = 0; i < KEY_COUNT; ++i)
+        hashes[i] = IdentityPointer(objects + i * STRIDE);
+
+    ReportProbes("pointers, identity", hashes, KEY_COUNT);
+
+    for (uint i = 0; i < KEY_COUNT; ++i)
+        hashes[i] = HashPointer(objects + i * STRIDE);
+
+    ReportProbes("pointers, HashPointer()", hashes, KEY_COUNT);
+
+    delete[] objects;
+}
+
+//----------------------------------------------------------------------------
+//
+//  Kurze Bezeichner, wie sie als Atoms und Namen von Eigenschaften
+//  vorkommen.
+//
+template <uint (*Fn)(const char*)>
+static void BenchStringQuality(const char* name, uint* hashes)
+{
+    char key[32];
+
+    for (uint i = 0; i < KEY_COUNT; ++i)
+    {
+        sprintf(key, "label%u", i);
+        hashes[i] = Fn(key);
+    }
+
+    ReportProbes(name, hashes, KEY_COUNT);
+}
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    static const uint sizes[] = { 4, 8, 16, 32, 64, 256, 4096 };
+
+    for (uint i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        BenchThroughput<FnvBuffer>("FNV-1a", sizes[i]);
+        BenchThroughput<NewBuffer>("HashBuffer()", sizes[i]);
+    }
+
+    uint* hashes = new uint[KEY_COUNT];
+
+    BenchPointerQuality(hashes);
+    BenchStringQuality<FnvString>("labels, FNV-1a", hashes);
+    BenchStringQuality<NewString>("labels, HashString()", hashes);
+
+    delete[] hashes;
+    return 0;
+}
+
+//----------------------------------------------------------------------------
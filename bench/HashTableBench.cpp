@@ -0,0 +1,142 @@
+#include "bench/Bench.h"
+#include "support/Collection.h"
+#include "support/Dict.h"
+#include "support/HashTable.h"
+
+//----------------------------------------------------------------------------
+//
+//  Vergleicht HashTable mit Dict bei Zeiger-Schluesseln, wie sie WinApp fuer
+//  die Zuordnung von Fenstern zu Handlern verwendet.
+//
+//  Die Schluessel sind die Adressen hintereinander liegender Objekte und
+//  unterscheiden sich daher nur in den mittleren Bits. Fuer jede Groesse n
+//  werden n Eintraege eingefuegt, alle n Schluessel gesucht, n nicht
+//  enthaltene Schluessel gesucht und alle Eintraege mit Take() entfernt.
+//  Kleine Groessen werden mit so vielen Tabellen gemessen, dass jede
+//  Messung mindestens MIN_OPERATIONS Operationen umfasst.
+//
+//  Gemessen werden ein Dict mit der Standardgroesse 17, wie es WinApp
+//  frueher verwendete, ein Dict mit automatischer Groessenanpassung und
+//  eine HashTable. Das Dict fester Groesse wird nur bis FIXED_DICT_LIMIT
+//  Eintraege gemessen, da seine Listen linear mit n wachsen.
+//
+
+volatile uint bench_sink;
+
+static const uint MIN_OPERATIONS = 1000000;
+static const uint FIXED_DICT_LIMIT = 10000;
+
+static int _item;
+
+//----------------------------------------------------------------------------
+//
+//  Nachbildung eines Fensters, dessen Adresse als Schluessel dient.
+//
+struct BenchWindow
+{
+    char data[64];
+};
+
+typedef Dict<BenchWindow*, int, DefaultHash<BenchWindow*>,
+             SharedOwnership<int> > PointerDict;
+
+typedef HashTable<BenchWindow*, int, DefaultHash<BenchWindow*>,
+                  SharedOwnership<int> > PointerHashTable;
+
+class AutoResizeDict: public PointerDict
+{
+public:
+
+    AutoResizeDict()
+    { SetAutoResize(true); }
+};
+
+//----------------------------------------------------------------------------
+
+template <class Table>
+static void BenchTable(const char* name, uint count)
+{
+    uint tables = Max(MIN_OPERATIONS / count, 1u);
+    uint operations = tables * count;
+    BenchWindow* windows = new BenchWindow[count];
+    BenchWindow* others = new BenchWindow[count];
+    Table* table = new Table[tables];
+    uint sum = 0;
+
+    BenchTimer insert_timer;
+
+    for (uint t = 0; t < tables; ++t)
+    {
+        for (uint i = 0; i < count; ++i)
+            table[t].Insert(&windows[i], &_item);
+    }
+
+    double insert_time = insert_timer.Seconds();
+    BenchTimer hit_timer;
+
+    for (uint t = 0; t < tables; ++t)
+    {
+        for (uint i = 0; i < count; ++i)
+            sum += table[t].Find(&windows[i]) != nullptr;
+    }
+
+    double hit_time = hit_timer.Seconds();
+    BenchTimer miss_timer;
+
+    for (uint t = 0; t < tables; ++t)
+    {
+        for (uint i = 0; i < count; ++i)
+            sum += table[t].Find(&others[i]) != nullptr;
+    }
+
+    double miss_time = miss_timer.Seconds();
+    BenchTimer take_timer;
+
+    for (uint t = 0; t < tables; ++t)
+    {
+        for (uint i = 0; i < count; ++i)
+            sum += table[t].Take(&windows[i]) != nullptr;
+    }
+
+    double take_time = take_timer.Seconds();
+
+    bench_sink = sum;
+
+    char label[64];
+
+    sprintf(label, "%s Insert(), n = %u", name, count);
+    BenchReport(label, operations, insert_time);
+
+    sprintf(label, "%s Find() hit, n = %u", name, count);
+    BenchReport(label, operations, hit_time);
+
+    sprintf(label, "%s Find() miss, n = %u", name, count);
+    BenchReport(label, operations, miss_time);
+
+    sprintf(label, "%s Take(), n = %u", name, count);
+    BenchReport(label, operations, take_time);
+
+    delete[] table;
+    delete[] others;
+    delete[] windows;
+}
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    static const uint counts[] = { 100, 1000, 10000, 100000 };
+
+    for (uint i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+    {
+        if (counts[i] <= FIXED_DICT_LIMIT)
+            BenchTable<PointerDict>("Dict(17)", counts[i]);
+
+        BenchTable<AutoResizeDict>("Dict, auto-resize", counts[i]);
+        BenchTable<PointerHashTable>("HashTable", counts[i]);
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------
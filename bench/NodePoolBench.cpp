@@ -0,0 +1,227 @@
+#include "bench/Bench.h"
+#include "support/Collection.h"
+#include "support/Dict.h"
+#include "support/List.h"
+
+#include <cstdlib>
+#include <new>
+
+//----------------------------------------------------------------------------
+//
+//  Misst, wie viele Anforderungen an den Heap List und Dict mit ihrem
+//  NodePool noch stellen, und wie schnell staendiges Einfuegen und
+//  Entfernen damit ist.
+//
+//  Fuer jede Groesse n wird ein Container mit n Elementen gefuellt und
+//  danach so lange das erste Element entnommen und ein neues angehaengt
+//  bzw. eingefuegt, bis mindestens MIN_OPERATIONS Elemente bewegt wurden.
+//  Zum Vergleich dient eine einfache Warteschlange, die jeden Knoten wie
+//  frueher List einzeln mit new anlegt und mit delete freigibt.
+//
+//  Gezaehlt werden alle Aufrufe von operator new waehrend einer Messung,
+//  bei Dict also auch die Listen der Hash-Tabelle. Angegeben wird die Dauer
+//  je bewegtem Element und die Zahl der Anforderungen insgesamt.
+//
+
+volatile uint bench_sink;
+
+static const uint MIN_OPERATIONS = 10000000;
+
+static uint _allocations;
+
+static int _item;
+
+//----------------------------------------------------------------------------
+
+void* operator new(size_t size) throw(std::bad_alloc)
+{
+    ++_allocations;
+
+    void* p = malloc(size != 0 ? size : 1);
+
+    if (p == nullptr)
+        throw std::bad_alloc();
+
+    return p;
+}
+
+//----------------------------------------------------------------------------
+
+void operator delete(void* p) throw()
+{
+    free(p);
+}
+
+//----------------------------------------------------------------------------
+//
+//  Warteschlange mit einzeln angeforderten Knoten als Vergleich.
+//
+class BenchQueue
+{
+public:
+
+    BenchQueue()
+        : m_first(nullptr), m_last(nullptr) {}
+
+    ~BenchQueue()
+    {
+        while (m_first != nullptr)
+            Take();
+    }
+
+    void Append(int* data)
+    {
+        Node* node = new Node;
+        node->data = data;
+        node->next = nullptr;
+
+        if (m_last != nullptr)
+            m_last->next = node;
+        else
+            m_first = node;
+
+        m_last = node;
+    }
+
+    int* Take()
+    {
+        Node* node = m_first;
+        int* data = node->data;
+
+        m_first = node->next;
+
+        if (m_first == nullptr)
+            m_last = nullptr;
+
+        delete node;
+        return data;
+    }
+
+private:
+
+    struct Node
+    {
+        int*    data;
+        Node*   next;
+    };
+
+    Node*   m_first;
+    Node*   m_last;
+};
+
+typedef List<int, SharedOwnership<int> > IntList;
+
+typedef Dict<uint, int, DefaultHash<uint>, SharedOwnership<int> > UintDict;
+
+//----------------------------------------------------------------------------
+
+static void Report(const char* name, uint count, uint operations,
+                   uint allocations, double seconds)
+{
+    char label[64];
+
+    sprintf(label, "%s, n = %u", name, count);
+    BenchReport(label, operations, seconds);
+    printf("    %u allocations, %.4f per op\n", allocations,
+           double(allocations) / operations);
+}
+
+//----------------------------------------------------------------------------
+
+static void BenchPlainNew(uint count)
+{
+    uint operations = Max(MIN_OPERATIONS / count, 1u) * count;
+    uint start_allocations = _allocations;
+    BenchTimer timer;
+
+    {
+        BenchQueue queue;
+
+        for (uint i = 0; i < count; ++i)
+            queue.Append(&_item);
+
+        for (uint i = 0; i < operations; ++i)
+            queue.Append(queue.Take());
+    }
+
+    double seconds = timer.Seconds();
+
+    Report("new/delete queue", count, operations,
+           _allocations - start_allocations, seconds);
+}
+
+//----------------------------------------------------------------------------
+
+static void BenchList(uint count)
+{
+    uint operations = Max(MIN_OPERATIONS / count, 1u) * count;
+    uint start_allocations = _allocations;
+    BenchTimer timer;
+
+    {
+        IntList list;
+
+        for (uint i = 0; i < count; ++i)
+            list.Append(&_item);
+
+        for (uint i = 0; i < operations; ++i)
+        {
+            IntList::Iterator first = list.Begin();
+            list.Append(list.Take(first));
+        }
+    }
+
+    double seconds = timer.Seconds();
+
+    Report("List", count, operations, _allocations - start_allocations,
+           seconds);
+}
+
+//----------------------------------------------------------------------------
+
+static void BenchDict(uint count)
+{
+    uint operations = Max(MIN_OPERATIONS / count, 1u) * count;
+    uint start_allocations = _allocations;
+    uint sum = 0;
+    BenchTimer timer;
+
+    {
+        UintDict dict;
+
+        dict.SetAutoResize(true);
+
+        for (uint i = 0; i < count; ++i)
+            dict.Insert(i, &_item);
+
+        for (uint i = 0; i < operations; ++i)
+        {
+            sum += dict.Take(i) != nullptr;
+            dict.Insert(i + count, &_item);
+        }
+    }
+
+    double seconds = timer.Seconds();
+
+    bench_sink = sum;
+    Report("Dict, auto-resize", count, operations,
+           _allocations - start_allocations, seconds);
+}
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    static const uint counts[] = { 10, 1000, 100000 };
+
+    for (uint i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+    {
+        BenchPlainNew(counts[i]);
+        BenchList(counts[i]);
+        BenchDict(counts[i]);
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------
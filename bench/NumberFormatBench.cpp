@@ -0,0 +1,156 @@
+#include "bench/Bench.h"
+#include "support/NumberFormat.h"
+#include "support/String.h"
+
+//----------------------------------------------------------------------------
+//
+//  Vergleicht die Funktionen aus NumberFormat.h mit sprintf() beim
+//  Formatieren grosser Mengen von Zahlen, etwa fuer eine Tabelle oder den
+//  Export von Messwerten.
+//
+//  Formatiert werden NUMBER_COUNT zufaellige ganze Zahlen, Gleitkommazahlen
+//  mit 4 signifikanten Stellen und Gleitkommazahlen in der kuerzesten
+//  exakten Darstellung (sprintf() mit "%.17g"). Danach formatieren
+//  THREAD_COUNT Threads gleichzeitig je NUMBER_COUNT Gleitkommazahlen.
+//  Unter Windows misst clock() die verstrichene Zeit; auf Systemen, auf
+//  denen clock() die Rechenzeit aller Threads addiert, sind die Ergebnisse
+//  nur mit einem Prozessor vergleichbar.
+//
+
+volatile uint bench_sink;
+
+static const uint NUMBER_COUNT = 1000000;
+static const uint THREAD_COUNT = 4;
+
+static int* _integers;
+static double* _doubles;
+
+//----------------------------------------------------------------------------
+
+struct FormatIntegerFn
+{
+    uint operator()(char* buffer, uint i) const
+    { return FormatInteger(buffer, _integers[i]); }
+};
+
+struct PrintIntegerFn
+{
+    uint operator()(char* buffer, uint i) const
+    { return sprintf(buffer, "%d", _integers[i]); }
+};
+
+struct ToStringIntegerFn
+{
+    uint operator()(char*, uint i) const
+    { return ToString(_integers[i]).Length(); }
+};
+
+struct FormatDoubleFn
+{
+    uint operator()(char* buffer, uint i) const
+    { return FormatDouble(buffer, _doubles[i]); }
+};
+
+struct PrintDoubleFn
+{
+    uint operator()(char* buffer, uint i) const
+    { return sprintf(buffer, "%.4g", _doubles[i]); }
+};
+
+struct FormatShortestFn
+{
+    uint operator()(char* buffer, uint i) const
+    { return FormatDouble(buffer, _doubles[i], 0); }
+};
+
+struct PrintShortestFn
+{
+    uint operator()(char* buffer, uint i) const
+    { return sprintf(buffer, "%.17g", _doubles[i]); }
+};
+
+//----------------------------------------------------------------------------
+
+template <class Fn>
+static void FormatNumbers(void*)
+{
+    char buffer[NUMBER_BUFFER_SIZE];
+    Fn fn;
+    uint sum = 0;
+
+    for (uint i = 0; i < NUMBER_COUNT; ++i)
+        sum += fn(buffer, i);
+
+    bench_sink = sum;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Fn>
+static void BenchFormat(const char* name)
+{
+    BenchTimer timer;
+
+    FormatNumbers<Fn>(nullptr);
+
+    BenchReport(name, NUMBER_COUNT, timer.Seconds());
+}
+
+//----------------------------------------------------------------------------
+
+template <class Fn>
+static void BenchThreads(const char* name)
+{
+    BenchThread* threads[THREAD_COUNT];
+    BenchTimer timer;
+
+    for (uint i = 0; i < THREAD_COUNT; ++i)
+        threads[i] = new BenchThread(FormatNumbers<Fn>, nullptr);
+
+    for (uint i = 0; i < THREAD_COUNT; ++i)
+        delete threads[i];
+
+    double seconds = timer.Seconds();
+
+    char label[64];
+
+    sprintf(label, "%s, %u threads", name, THREAD_COUNT);
+    BenchReport(label, THREAD_COUNT * NUMBER_COUNT, seconds);
+}
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    _integers = new int[NUMBER_COUNT];
+    _doubles = new double[NUMBER_COUNT];
+
+    uint random = 2463534242u;
+
+    for (uint i = 0; i < NUMBER_COUNT; ++i)
+    {
+        random ^= random << 13;
+        random ^= random >> 17;
+        random ^= random << 5;
+
+        _integers[i] = int(random) >> (random % 24);
+        _doubles[i] = double(_integers[i]) / double(1 + random % 10000);
+    }
+
+    BenchFormat<PrintIntegerFn>("sprintf(\"%d\")");
+    BenchFormat<FormatIntegerFn>("FormatInteger()");
+    BenchFormat<ToStringIntegerFn>("ToString(int)");
+    BenchFormat<PrintDoubleFn>("sprintf(\"%.4g\")");
+    BenchFormat<FormatDoubleFn>("FormatDouble(), 4 digits");
+    BenchFormat<PrintShortestFn>("sprintf(\"%.17g\")");
+    BenchFormat<FormatShortestFn>("FormatDouble(), shortest");
+
+    BenchThreads<PrintDoubleFn>("sprintf(\"%.4g\")");
+    BenchThreads<FormatDoubleFn>("FormatDouble(), 4 digits");
+
+    delete[] _doubles;
+    delete[] _integers;
+    return 0;
+}
+
+//----------------------------------------------------------------------------
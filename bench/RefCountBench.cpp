@@ -0,0 +1,96 @@
+#include "bench/Bench.h"
+#include "support/String.h"
+
+//----------------------------------------------------------------------------
+//
+//  Misst die Kosten des Referenzzaehlers von StringBody.
+//
+//  Das Programm wird zweimal uebersetzt: als RefCountBench.exe mit
+//  einfachem Zaehler und als AtomicRefCountBench.exe mit dem Makro
+//  STRING_ATOMIC_REFCOUNT. Gemessen wird das Kopieren und Zerstoeren eines
+//  Strings, dessen Zeichenkette zu lang fuer die Speicherung im String-
+//  Objekt ist, also genau ein Erhoehen und ein Verringern des Zaehlers.
+//
+//  Mit atomarem Zaehler wird zusaetzlich gemessen, wie THREAD_COUNT Threads
+//  gleichzeitig Kopien derselben Zeichenkette anlegen und zerstoeren und
+//  dabei um die Cache-Zeile des Zaehlers konkurrieren. Ohne das Makro
+//  waere dies nicht zulaessig.
+//
+
+volatile uint bench_sink;
+
+static const uint COPY_COUNT = 20000000;
+
+#ifdef STRING_ATOMIC_REFCOUNT
+static const char* const VARIANT = "atomic refcount";
+#else
+static const char* const VARIANT = "plain refcount";
+#endif
+
+//----------------------------------------------------------------------------
+
+static void CopyStrings(void* arg)
+{
+    const String& source = *static_cast<const String*>(arg);
+    uint sum = 0;
+
+    for (uint i = 0; i < COPY_COUNT; ++i)
+    {
+        String copy = source;
+        sum += copy.Length();
+    }
+
+    bench_sink = sum;
+}
+
+//----------------------------------------------------------------------------
+
+#ifdef STRING_ATOMIC_REFCOUNT
+
+static const uint THREAD_COUNT = 4;
+
+static void BenchSharedCopies(String& source)
+{
+    BenchThread* threads[THREAD_COUNT];
+    BenchTimer timer;
+
+    for (uint i = 0; i < THREAD_COUNT; ++i)
+        threads[i] = new BenchThread(CopyStrings, &source);
+
+    for (uint i = 0; i < THREAD_COUNT; ++i)
+        delete threads[i];
+
+    double seconds = timer.Seconds();
+
+    char label[64];
+
+    sprintf(label, "%s, copy, %u threads", VARIANT, THREAD_COUNT);
+    BenchReport(label, THREAD_COUNT * COPY_COUNT, seconds);
+}
+
+#endif
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    String source("a string that does not fit inline");
+    BenchTimer timer;
+
+    CopyStrings(&source);
+
+    double seconds = timer.Seconds();
+
+    char label[64];
+
+    sprintf(label, "%s, copy", VARIANT);
+    BenchReport(label, COPY_COUNT, seconds);
+
+#ifdef STRING_ATOMIC_REFCOUNT
+    BenchSharedCopies(source);
+#endif
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------
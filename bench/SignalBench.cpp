@@ -0,0 +1,148 @@
+#include "bench/Bench.h"
+#include "support/Signal.h"
+
+//----------------------------------------------------------------------------
+//
+//  Misst das Aktivieren eines Signals mit 1, 10 und 1000 verbundenen Slots.
+//
+//  Jede Messung umfasst etwa SLOT_CALLS Slot-Aufrufe; angegeben wird die
+//  Dauer einer Aktivierung. Zum Vergleich wird die fruehere Verbindungsliste
+//  des Signals nachgebildet, eine verkettete Liste einzeln angelegter
+//  Knoten, deren Slots ueber eine virtuelle Funktion aufgerufen werden.
+//
+
+volatile uint bench_sink;
+
+static const uint SLOT_CALLS = 10000000;
+
+//----------------------------------------------------------------------------
+
+class BenchReceiver
+{
+public:
+
+    BenchReceiver()
+        : m_sum(0) {}
+
+    void ValueChanged(int value)
+    { m_sum += value; }
+
+    uint Sum() const
+    { return m_sum; }
+
+private:
+
+    uint m_sum;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Nachbildung der frueheren Signal-Implementierung.
+//
+struct OldConnection
+{
+    OldConnection(BenchReceiver* receiver, OldConnection* next)
+        : receiver(receiver), next(next) {}
+
+    virtual ~OldConnection() {}
+
+    virtual void EmitSignal(int) = 0;
+
+    BenchReceiver*  receiver;
+    OldConnection*  next;
+};
+
+struct OldConnectionImpl: public OldConnection
+{
+    typedef void (BenchReceiver::*MemberFn)(int);
+
+    OldConnectionImpl(BenchReceiver* receiver, MemberFn fn,
+                      OldConnection* next)
+        : OldConnection(receiver, next), fn(fn) {}
+
+    void EmitSignal(int arg)
+    { (receiver->*fn)(arg); }
+
+    MemberFn fn;
+};
+
+class OldSignal
+{
+public:
+
+    OldSignal()
+        : m_connections(nullptr) {}
+
+    ~OldSignal()
+    {
+        while (m_connections != nullptr)
+        {
+            OldConnection* c = m_connections;
+            m_connections = c->next;
+            delete c;
+        }
+    }
+
+    void operator()(int arg)
+    {
+        for (OldConnection* c = m_connections; c != nullptr; c = c->next)
+            c->EmitSignal(arg);
+    }
+
+    void Connect(BenchReceiver* receiver, void (BenchReceiver::*fn)(int))
+    { m_connections = new OldConnectionImpl(receiver, fn, m_connections); }
+
+private:
+
+    OldConnection* m_connections;
+};
+
+//----------------------------------------------------------------------------
+
+template <class SignalType>
+static void BenchEmit(const char* name, uint count)
+{
+    SignalType signal;
+    BenchReceiver* receivers = new BenchReceiver[count];
+
+    for (uint i = 0; i < count; ++i)
+        signal.Connect(&receivers[i], &BenchReceiver::ValueChanged);
+
+    uint emits = SLOT_CALLS / count;
+    BenchTimer timer;
+
+    for (uint i = 0; i < emits; ++i)
+        signal(int(i));
+
+    double seconds = timer.Seconds();
+    uint sum = 0;
+
+    for (uint i = 0; i < count; ++i)
+        sum += receivers[i].Sum();
+
+    bench_sink = sum;
+
+    char label[64];
+
+    sprintf(label, "%s emit, %u receivers", name, count);
+    BenchReport(label, emits, seconds);
+
+    delete[] receivers;
+}
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    static const uint counts[] = { 1, 10, 1000 };
+
+    for (uint i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+    {
+        BenchEmit<OldSignal>("Linked list", counts[i]);
+        BenchEmit<Signal<int> >("Signal", counts[i]);
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,170 @@
+#include "bench/Bench.h"
+#include "support/Collection.h"
+#include "support/List.h"
+#include "support/SkipList.h"
+#include "support/Vector.h"
+
+//----------------------------------------------------------------------------
+//
+//  Vergleicht SkipList mit Vector und List beim Zugriff ueber die Position.
+//
+//  Fuer jede Groesse n werden n Elemente an zufaelligen Positionen
+//  eingefuegt, n zufaellige Positionen gelesen und alle Elemente an
+//  zufaelligen Positionen wieder entfernt. Kleine Groessen werden so oft
+//  wiederholt, dass jede Messung mindestens MIN_OPERATIONS Operationen
+//  umfasst. Eine List muss jede Position abzaehlen; sie wird deshalb nur
+//  bis LIST_LIMIT Elemente gemessen.
+//
+
+volatile uint bench_sink;
+
+static const uint MIN_OPERATIONS = 100000;
+static const uint LIST_LIMIT = 10000;
+
+static int _items[1];
+static uint _random = 2463534242u;
+
+//----------------------------------------------------------------------------
+
+static uint Random(uint range)
+{
+    _random ^= _random << 13;
+    _random ^= _random >> 17;
+    _random ^= _random << 5;
+
+    return _random % range;
+}
+
+//----------------------------------------------------------------------------
+//
+//  Einheitlicher Zugriff ueber die Position fuer die drei Container.
+//
+typedef Vector<int, SharedOwnership<int> >      IntVector;
+typedef List<int, SharedOwnership<int> >        IntList;
+typedef SkipList<int, SharedOwnership<int> >    IntSkipList;
+
+static void InsertAt(IntVector& vector, int* data, uint pos)
+{ vector.Insert(data, pos); }
+
+static int* GetAt(const IntVector& vector, uint pos)
+{ return vector.At(pos); }
+
+static void RemoveAt(IntVector& vector, uint pos)
+{ vector.Remove(pos); }
+
+static void InsertAt(IntSkipList& list, int* data, uint pos)
+{ list.Insert(data, pos); }
+
+static int* GetAt(const IntSkipList& list, uint pos)
+{ return list.At(pos); }
+
+static void RemoveAt(IntSkipList& list, uint pos)
+{ list.Remove(pos); }
+
+//
+//  Eine List wird vom naeheren Ende aus abgezaehlt.
+//
+static IntList::Iterator IteratorAt(IntList& list, uint pos)
+{
+    IntList::Iterator it;
+
+    if (pos <= list.Count() / 2)
+    {
+        it = list.Begin();
+
+        for (uint i = 0; i < pos; ++i)
+            ++it;
+    }
+    else
+    {
+        it = list.End();
+
+        for (uint i = list.Count(); i > pos; --i)
+            --it;
+    }
+
+    return it;
+}
+
+static void InsertAt(IntList& list, int* data, uint pos)
+{ list.Insert(data, IteratorAt(list, pos)); }
+
+static int* GetAt(IntList& list, uint pos)
+{ return IteratorAt(list, pos).Get(); }
+
+static void RemoveAt(IntList& list, uint pos)
+{
+    IntList::Iterator it = IteratorAt(list, pos);
+    list.Remove(it);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Container>
+static void BenchContainer(const char* name, uint count)
+{
+    uint rounds = Max(MIN_OPERATIONS / count, 1u);
+    double insert_time = 0.0;
+    double at_time = 0.0;
+    double remove_time = 0.0;
+    uint sum = 0;
+
+    for (uint round = 0; round < rounds; ++round)
+    {
+        Container container;
+
+        BenchTimer insert_timer;
+
+        for (uint i = 0; i < count; ++i)
+            InsertAt(container, _items, Random(i + 1));
+
+        insert_time += insert_timer.Seconds();
+
+        BenchTimer at_timer;
+
+        for (uint i = 0; i < count; ++i)
+            sum += GetAt(container, Random(count)) == _items;
+
+        at_time += at_timer.Seconds();
+
+        BenchTimer remove_timer;
+
+        for (uint i = count; i > 0; --i)
+            RemoveAt(container, Random(i));
+
+        remove_time += remove_timer.Seconds();
+    }
+
+    bench_sink = sum;
+
+    char label[64];
+
+    sprintf(label, "%s Insert(i), n = %u", name, count);
+    BenchReport(label, rounds * count, insert_time);
+
+    sprintf(label, "%s At(i), n = %u", name, count);
+    BenchReport(label, rounds * count, at_time);
+
+    sprintf(label, "%s Remove(i), n = %u", name, count);
+    BenchReport(label, rounds * count, remove_time);
+}
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    static const uint counts[] = { 1000, 10000, 100000 };
+
+    for (uint i = 0; i < sizeof(counts) / sizeof(counts[0]); ++i)
+    {
+        BenchContainer<IntSkipList>("SkipList", counts[i]);
+        BenchContainer<IntVector>("Vector", counts[i]);
+
+        if (counts[i] <= LIST_LIMIT)
+            BenchContainer<IntList>("List", counts[i]);
+    }
+
+    return 0;
+}
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,173 @@
+#include "bench/Bench.h"
+#include "support/String.h"
+
+#include <cstdlib>
+#include <new>
+
+//----------------------------------------------------------------------------
+//
+//  Misst typische Operationen auf kurzen Zeichenketten, wie sie als
+//  Beschriftungen von Fenstern, Menues und Schaltflaechen vorkommen.
+//
+//  Fuer LABEL_COUNT Beschriftungen mit 2 bis 10 Zeichen werden Strings
+//  erzeugt und zerstoert, Strings kopiert und Kopien um ein Zeichen
+//  verlaengert. Die kurzen Strings liegen direkt im String-Objekt. Zum
+//  Vergleich werden dieselben Beschriftungen mit reservierter Kapazitaet
+//  angelegt; sie verwenden wie frueher alle Strings einen StringBody auf
+//  dem Heap, den Kopien gemeinsam benutzen, bis sie veraendert werden.
+//
+//  Gezaehlt werden alle Aufrufe von operator new. Angegeben wird die Dauer
+//  je String und die Zahl der Anforderungen insgesamt.
+//
+
+volatile uint bench_sink;
+
+static const uint LABEL_COUNT = 1000;
+static const uint ROUNDS = 2000;
+static const uint BODY_CAPACITY = 32;
+
+static uint _allocations;
+
+//----------------------------------------------------------------------------
+
+void* operator new(size_t size) throw(std::bad_alloc)
+{
+    ++_allocations;
+
+    void* p = malloc(size != 0 ? size : 1);
+
+    if (p == nullptr)
+        throw std::bad_alloc();
+
+    return p;
+}
+
+//----------------------------------------------------------------------------
+
+void operator delete(void* p) throw()
+{
+    free(p);
+}
+
+//----------------------------------------------------------------------------
+
+static void Report(const char* name, const char* operation,
+                   uint allocations, double seconds)
+{
+    char label[64];
+
+    sprintf(label, "%s %s", name, operation);
+    BenchReport(label, LABEL_COUNT * ROUNDS, seconds);
+    printf("    %u allocations\n", allocations);
+}
+
+//----------------------------------------------------------------------------
+//
+//  Misst die Beschriftungen labels; ist capacity groesser als 0, werden
+//  die Strings mit dieser Kapazitaet angelegt.
+//
+static void BenchLabels(const char* name, const char* const* labels,
+                        uint capacity)
+{
+    String* sources = new String[LABEL_COUNT];
+    String* copies = new String[LABEL_COUNT];
+    uint sum = 0;
+
+    for (uint i = 0; i < LABEL_COUNT; ++i)
+    {
+        sources[i] = capacity > 0
+            ? String(capacity, labels[i]) : String(labels[i]);
+    }
+
+    uint start_allocations = _allocations;
+    BenchTimer construct_timer;
+
+    for (uint round = 0; round < ROUNDS; ++round)
+    {
+        for (uint i = 0; i < LABEL_COUNT; ++i)
+        {
+            if (capacity > 0)
+                sum += String(capacity, labels[i]).Length();
+            else
+                sum += String(labels[i]).Length();
+        }
+    }
+
+    double construct_time = construct_timer.Seconds();
+    uint construct_allocations = _allocations - start_allocations;
+
+    start_allocations = _allocations;
+    BenchTimer copy_timer;
+
+    for (uint round = 0; round < ROUNDS; ++round)
+    {
+        for (uint i = 0; i < LABEL_COUNT; ++i)
+            copies[i] = sources[i];
+
+        for (uint i = 0; i < LABEL_COUNT; ++i)
+            copies[i] = String::Empty;
+    }
+
+    double copy_time = copy_timer.Seconds();
+    uint copy_allocations = _allocations - start_allocations;
+
+    start_allocations = _allocations;
+    BenchTimer append_timer;
+
+    for (uint round = 0; round < ROUNDS; ++round)
+    {
+        for (uint i = 0; i < LABEL_COUNT; ++i)
+        {
+            String label = sources[i];
+            label += ":";
+            sum += label.Length();
+        }
+    }
+
+    double append_time = append_timer.Seconds();
+    uint append_allocations = _allocations - start_allocations;
+
+    bench_sink = sum;
+
+    Report(name, "construct", construct_allocations, construct_time);
+    Report(name, "copy", copy_allocations, copy_time);
+    Report(name, "copy and append", append_allocations, append_time);
+
+    delete[] copies;
+    delete[] sources;
+}
+
+//----------------------------------------------------------------------------
+
+int main()
+{
+    static const char* const words[] =
+    {
+        "OK", "Cancel", "File", "Edit", "View", "Open...", "Save As...",
+        "Name", "Size", "Modified", "Properties", "Help"
+    };
+
+    static const uint word_count = sizeof(words) / sizeof(words[0]);
+
+    char* buffer = new char[LABEL_COUNT * 16];
+    const char** labels = new const char*[LABEL_COUNT];
+
+    for (uint i = 0; i < LABEL_COUNT; ++i)
+    {
+        labels[i] = buffer + i * 16;
+
+        if (i < word_count)
+            sprintf(buffer + i * 16, "%s", words[i]);
+        else
+            sprintf(buffer + i * 16, "Item %u", i);
+    }
+
+    BenchLabels("inline", labels, 0);
+    BenchLabels("StringBody", labels, BODY_CAPACITY);
+
+    delete[] labels;
+    delete[] buffer;
+    return 0;
+}
+
+//----------------------------------------------------------------------------
@@ -8,16 +8,11 @@ Container::Container(Container* parent, const Rect& frame, uint alignMode)
     : View(parent, frame, alignMode),
       m_oldSize(frame.width, frame.height),
       m_window(nullptr)
-{
-    m_childList.SetAutoDelete(true);
-}
+{}
 
 //----------------------------------------------------------------------------
 
-Container::Container()
-{
-    m_childList.SetAutoDelete(true);
-}
+Container::Container() {}
 
 //----------------------------------------------------------------------------
 
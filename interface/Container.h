@@ -2,7 +2,7 @@
 #define interface_Container_h
 
 #include "interface/View.h"
-#include "support/Vector.h"
+#include "support/SmallVector.h"
 
 class Window;
 
@@ -100,9 +100,11 @@ protected:
 
 private:
 
-    Vector<View>    m_childList;
-    Size            m_oldSize;
-    ::Window*       m_window;
+    typedef SmallVector<View, 8, ExclusiveOwnership<View> > ChildList;
+
+    ChildList   m_childList;
+    Size        m_oldSize;
+    ::Window*   m_window;
 };
 
 //----------------------------------------------------------------------------
@@ -205,28 +205,51 @@ public:
     { m_platformGraphics->DrawEdge(frame, style, edges, fill, softed); }
 
     //
-    //  Zeichnet den String text mit dem aktuell ausgewaehlten Font.
+    //  Zeichnet den Text text mit dem aktuell ausgewaehlten Font. text kann
+    //  ein String, eine Zeichenkette oder ein Ausschnitt davon sein.
     //  (x, y) bezeichnet den Startpunkt der Textausgabe. Wenn der Parameter
     //  length angegeben wird, gibt er die max. Anzahl Zeichen an, die
     //  ausgegeben werden sollen.
     //
-    void DrawText(int x, int y, String text)
-    { m_platformGraphics->DrawText(x, y, text, text.Length()); }
+    void DrawText(int x, int y, const StringRef& text)
+    { m_platformGraphics->DrawText(x, y, text); }
 
-    void DrawText(int x, int y, String text, uint length)
-    { m_platformGraphics->DrawText(x, y, text, length); }
+    void DrawText(int x, int y, const StringRef& text, uint length)
+    { m_platformGraphics->DrawText(x, y, text.Left(length)); }
 
-    void DrawText(const Rect& frame, String text,
+    void DrawText(const Rect& frame, const StringRef& text,
                   uint flags = SINGLELINE_TEXT | ALIGN_LEFT | ALIGN_TOP)
     { m_platformGraphics->DrawText(frame, text, flags); }
 
     //
-    //  Liefert Breite und Hoehe des String text, bezogen auf den aktuell
+    //  Liefert Breite und Hoehe des Texts text, bezogen auf den aktuell
     //  ausgewaehlten Font.
     //
-    void GetTextBounds(String text, int* width, int* height)
+    void GetTextBounds(const StringRef& text, int* width, int* height)
     { return m_platformGraphics->GetTextBounds(text, width, height); }
 
+    //
+    //  Varianten von DrawText() und GetTextBounds() fuer das Ergebnis einer
+    //  Verknuepfung mit operator+, z.B. DrawText(x, y, label + ":"). Der
+    //  Text wird dazu einmal in einen String kopiert (siehe StringSum).
+    //
+    template <class L, class R>
+    void DrawText(int x, int y, const StringSum<L, R>& text)
+    { DrawText(x, y, text.Str()); }
+
+    template <class L, class R>
+    void DrawText(int x, int y, const StringSum<L, R>& text, uint length)
+    { DrawText(x, y, text.Str(), length); }
+
+    template <class L, class R>
+    void DrawText(const Rect& frame, const StringSum<L, R>& text,
+                  uint flags = SINGLELINE_TEXT | ALIGN_LEFT | ALIGN_TOP)
+    { DrawText(frame, text.Str(), flags); }
+
+    template <class L, class R>
+    void GetTextBounds(const StringSum<L, R>& text, int* width, int* height)
+    { GetTextBounds(text.Str(), width, height); }
+
     //
     //  Setzt ein Pixel an (x, y) in der aktuellen Farbe bzw. in der
     //  Farbe c.
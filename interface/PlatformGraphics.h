@@ -36,9 +36,11 @@ public:
     virtual void FillRect(int x, int y, int width, int height) = 0;
     virtual void DrawEdge(const Rect& frame, int style, int edges, bool fill,
                           bool softed) = 0;
-    virtual void DrawText(const Rect& frame, String text, uint flags) = 0;
-    virtual void DrawText(int x, int y, String text, uint length) = 0;
-    virtual void GetTextBounds(String text, int* width, int* height) = 0;
+    virtual void DrawText(const Rect& frame, const StringRef& text,
+                          uint flags) = 0;
+    virtual void DrawText(int x, int y, const StringRef& text) = 0;
+    virtual void GetTextBounds(const StringRef& text, int* width,
+                               int* height) = 0;
     virtual void SetPixel(int x, int y, Color c) = 0;
     virtual Color GetPixel(int x, int y) = 0;
     virtual void DrawBitmap(const PlatformBitmap* bitmap, int x, int y) = 0;
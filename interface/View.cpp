@@ -222,87 +222,87 @@ void View::MessageReceived(Message* message)
         break;
 
     case MSG_KEY_DOWN:
-        message->FindInt("key", &key);
+        message->FindInt(FIELD_KEY, &key);
         KeyDown(key);
         break;
 
     case MSG_KEY_UP:
-        message->FindInt("key", &key);
+        message->FindInt(FIELD_KEY, &key);
         KeyUp(key);
         break;
 
     case MSG_KEY_PRESSED:
-        message->FindInt("char", &key);
+        message->FindInt(FIELD_CHAR, &key);
         KeyPressed(key);
         break;
 
     case MSG_MOUSE_DOWN:
-        message->FindInt("xpos", &point.x);
-        message->FindInt("ypos", &point.y);
-        message->FindInt("keys", &key);
-        message->FindInt("button", &id);
+        message->FindInt(FIELD_XPOS, &point.x);
+        message->FindInt(FIELD_YPOS, &point.y);
+        message->FindInt(FIELD_KEYS, &key);
+        message->FindInt(FIELD_BUTTON, &id);
         MouseDown(point, id, key);
         break;
 
     case MSG_MOUSE_UP:
-        message->FindInt("xpos", &point.x);
-        message->FindInt("ypos", &point.y);
-        message->FindInt("keys", &key);
-        message->FindInt("button", &id);
+        message->FindInt(FIELD_XPOS, &point.x);
+        message->FindInt(FIELD_YPOS, &point.y);
+        message->FindInt(FIELD_KEYS, &key);
+        message->FindInt(FIELD_BUTTON, &id);
         MouseUp(point, id, key);
         break;
 
     case MSG_MOUSE_MOVED:
-        message->FindInt("xpos", &point.x);
-        message->FindInt("ypos", &point.y);
-        message->FindInt("keys", &key);
+        message->FindInt(FIELD_XPOS, &point.x);
+        message->FindInt(FIELD_YPOS, &point.y);
+        message->FindInt(FIELD_KEYS, &key);
         MouseMoved(point, key);
         break;
 
     case MSG_MOUSE_DOUBLECLICK:
-        message->FindInt("xpos", &point.x);
-        message->FindInt("ypos", &point.y);
-        message->FindInt("keys", &key);
-        message->FindInt("button", &id);
+        message->FindInt(FIELD_XPOS, &point.x);
+        message->FindInt(FIELD_YPOS, &point.y);
+        message->FindInt(FIELD_KEYS, &key);
+        message->FindInt(FIELD_BUTTON, &id);
         MouseDoubleClick(point, id, key);
         break;
 
     case MSG_PULSE:
-        message->FindInt("timer", &id);
+        message->FindInt(FIELD_TIMER, &id);
         Pulse(id);
         break;
 
     case MSG_VIEW_FOCUS_CHANGED:
-        message->FindBool("focused", &flag);
+        message->FindBool(FIELD_FOCUSED, &flag);
         FocusChanged(flag);
         break;
 
     case MSG_VIEW_RESIZED:
-        message->FindInt("width", &size.width);
-        message->FindInt("height", &size.height);
+        message->FindInt(FIELD_WIDTH, &size.width);
+        message->FindInt(FIELD_HEIGHT, &size.height);
         m_frame.ResizeTo(size);
         FrameResized(size);
         break;
 
     case MSG_VIEW_MOVED:
-        message->FindInt("xpos", &point.x);
-        message->FindInt("ypos", &point.y);
+        message->FindInt(FIELD_XPOS, &point.x);
+        message->FindInt(FIELD_YPOS, &point.y);
         m_frame.OffsetTo(point);
         FrameMoved(point);
         break;
 
     case MSG_VIEW_VISIBILITY_CHANGED:
-        message->FindBool("show", &flag);
+        message->FindBool(FIELD_SHOW, &flag);
         VisibilityChanged(flag);
         break;
 
     case MSG_VIEW_ENABLED:
-        message->FindBool("enabled", &flag);
+        message->FindBool(FIELD_ENABLED, &flag);
         Enabled(flag);
         break;
 
     case MSG_COMMAND:
-        message->FindInt("cmd", &id);
+        message->FindInt(FIELD_COMMAND, &id);
         ProcessCommand(id);
         break;
 
@@ -288,7 +288,8 @@ void WinGraphics::DrawEdge(const Rect& frame, int style, int edges, bool fill,
 
 //----------------------------------------------------------------------------
 
-void WinGraphics::DrawText(const Rect& frame, String text, uint flags)
+void WinGraphics::DrawText(const Rect& frame, const StringRef& text,
+                           uint flags)
 {
     RECT r;
     UINT format = 0;
@@ -314,24 +315,24 @@ void WinGraphics::DrawText(const Rect& frame, String text, uint flags)
     else if (TestBits(flags, ALIGN_V_CENTER))
         format |= DT_VCENTER;
 
-    ::DrawTextA(m_dc, text.CStr(), -1, &r, format);
+    ::DrawTextA(m_dc, text.Data(), text.Length(), &r, format);
 }
 
 //----------------------------------------------------------------------------
 
-void WinGraphics::DrawText(int x, int y, String text, uint length)
+void WinGraphics::DrawText(int x, int y, const StringRef& text)
 {
-    uint nchars = Min(length, text.Length());
-    ::TextOut(m_dc, x, y, text.CStr(), nchars);
+    ::TextOut(m_dc, x, y, text.Data(), text.Length());
 }
 
 //----------------------------------------------------------------------------
 
-void WinGraphics::GetTextBounds(String text, int* width, int* height)
+void WinGraphics::GetTextBounds(const StringRef& text, int* width,
+                                int* height)
 {
     SIZE s;
 
-    ::GetTextExtentPoint32(m_dc, text.CStr(), text.Length(), &s);
+    ::GetTextExtentPoint32(m_dc, text.Data(), text.Length(), &s);
     *height = s.cy;
     *width = s.cx;
 }
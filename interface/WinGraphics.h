@@ -40,9 +40,9 @@ public:
     void DrawRect(int x, int y, int width, int height);
     void FillRect(int x, int y, int width, int height);
     void DrawEdge(const Rect& frame, int style, int edges, bool fill, bool softed);
-    void DrawText(const Rect& frame, String text, uint flags);
-    void DrawText(int x, int y, String text, uint length);
-    void GetTextBounds(String text, int* width, int* height);
+    void DrawText(const Rect& frame, const StringRef& text, uint flags);
+    void DrawText(int x, int y, const StringRef& text);
+    void GetTextBounds(const StringRef& text, int* width, int* height);
     void SetPixel(int x, int y, Color c);
     Color GetPixel(int x, int y);
     void DrawBitmap(const PlatformBitmap* bitmap, int x, int y);
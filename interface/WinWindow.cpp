@@ -174,9 +174,9 @@ Margins WinWindow::FrameMargins() const
 String WinWindow::Text() const
 {
     size_t capacity = ::GetWindowTextLength(m_hWindow);
-    char* text = new char[capacity];
+    char* text = new char[capacity + 1];
 
-    ::GetWindowText(m_hWindow, text, capacity);
+    ::GetWindowText(m_hWindow, text, capacity + 1);
     return String::FromBuffer(text, capacity);
 }
 
@@ -138,7 +138,7 @@ void Window::MessageReceived(Message* message)
     switch (message->what)
     {
     case MSG_WINDOW_ACTIVATED:
-        message->FindBool("active", &flag);
+        message->FindBool(FIELD_ACTIVE, &flag);
         WindowActivated(flag);
         break;
 
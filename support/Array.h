@@ -0,0 +1,580 @@
+#ifndef support_Array_h
+#define support_Array_h
+
+#include "support/Exception.h"
+#include "support/Utilities.h"
+
+#include <climits>
+#include <new>
+
+//----------------------------------------------------------------------------
+//
+//  Template-Klasse, die ein Array mit automatischer Groessenanpassung
+//  bereitstellt, das seine Elemente direkt speichert.
+//
+//  Im Gegensatz zu Vector, das nur Zeiger auf einzeln angelegte Objekte
+//  verwaltet, liegen die Elemente eines Array-Objekts hintereinander in einem
+//  einzigen Speicherblock. Das Durchlaufen eines Arrays kommt daher ohne
+//  eine Zeiger-Dereferenzierung pro Element aus und nutzt den Cache deutlich
+//  besser. Dafuer werden Elemente beim Einfuegen kopiert, und Zeiger oder
+//  Referenzen auf Elemente werden ungueltig, sobald das Array waechst oder
+//  Elemente verschoben werden.
+//
+//  Der reservierte Speicher waechst wie bei Vector bei Bedarf um den Faktor
+//  1.5 und kann mit Shrink() auf die minimal benoetigte Groesse reduziert
+//  werden. Der Elementtyp T muss kopierbar sein.
+//
+template <class T>
+class Array
+{
+public:
+
+    static const uint   INITIAL_CAPACITY    = 8;
+    static const uint   MIN_CAPACITY        = 4;
+    static const uint   MAX_CAPACITY        = UINT_MAX / sizeof(T);
+
+    //
+    //  Erstellt ein leeres Array, das Platz fuer capacity Elemente hat.
+    //
+    explicit Array(uint capacity = INITIAL_CAPACITY);
+
+    //
+    //  Erstellt eine Kopie von array. Im Gegensatz zu den Collection-Klassen
+    //  koennen Arrays kopiert werden, da sie ihre Elemente selbst besitzen.
+    //
+    Array(const Array<T>& array);
+
+#if __cplusplus >= 201103L
+    //
+    //  Uebernimmt den Speicherblock von array, ohne Elemente zu kopieren.
+    //  array ist danach leer.
+    //
+    Array(Array<T>&& array)
+        : m_capacity(0), m_count(0), m_data(nullptr)
+    { Swap(array); }
+#endif
+
+    //
+    //  Zerstoert alle Elemente und gibt den reservierten Speicher frei.
+    //
+    ~Array();
+
+    //
+    //  Weist dem Array eine Kopie von array zu.
+    //
+    Array<T>& operator=(const Array<T>& array);
+
+#if __cplusplus >= 201103L
+    //
+    //  Tauscht den Inhalt des Arrays mit dem von array, ohne Elemente zu
+    //  kopieren.
+    //
+    Array<T>& operator=(Array<T>&& array)
+    { Swap(array); return *this; }
+#endif
+
+    //
+    //  Haengt Kopien der Elemente von array an das Ende des Arrays an.
+    //
+    Array<T>& operator+=(const Array<T>& array)
+    { return Append(array); }
+
+    //
+    //  Liefert die Anzahl der Elemente des Arrays.
+    //
+    uint Count() const
+    { return m_count; }
+
+    //
+    //  Liefert die Anzahl der Elemente, fuer die Speicher reserviert ist.
+    //
+    uint Capacity() const
+    { return m_capacity; }
+
+    //
+    //  Liefert true, wenn das Array keine Elemente enthaelt.
+    //
+    bool IsEmpty() const
+    { return m_count == 0; }
+
+    //
+    //  Liefert die Position des ersten Elements.
+    //
+    uint Begin() const
+    { return 0; }
+
+    //
+    //  Liefert die Position hinter dem letzten Element.
+    //
+    uint End() const
+    { return m_count; }
+
+    //
+    //  Liefert das Element an der Position pos. pos wird nicht auf
+    //  Gueltigkeit geprueft.
+    //
+    T& operator[](uint pos)
+    { return m_data[pos]; }
+
+    const T& operator[](uint pos) const
+    { return m_data[pos]; }
+
+    //
+    //  Liefert einen Zeiger auf das Element an der Position pos oder Null,
+    //  wenn pos ausserhalb des erlaubten Bereiches liegt.
+    //
+    T* At(uint pos)
+    { return pos < m_count ? &m_data[pos] : nullptr; }
+
+    const T* At(uint pos) const
+    { return pos < m_count ? &m_data[pos] : nullptr; }
+
+    //
+    //  Liefert einen Zeiger auf das erste Element. Die Elemente liegen
+    //  lueckenlos hintereinander im Speicher.
+    //
+    T* Data()
+    { return m_data; }
+
+    const T* Data() const
+    { return m_data; }
+
+    //
+    //  Liefert den Index des ersten Elements das gleich data ist, bzw. End(),
+    //  wenn kein solches Element gefunden wird.
+    //
+    //  Fuer diese Funktion muss der Operator "==" fuer Elemente des Typs T
+    //  definiert sein.
+    //
+    uint Find(const T& data) const
+    { return FindNext(data, 0); }
+
+    //
+    //  Liefert, ausgehend von der Position pos, den Index des ersten
+    //  Elements das gleich data ist, bzw. End(), wenn kein solches Element
+    //  gefunden wird.
+    //
+    uint FindNext(const T& data, uint pos) const;
+
+    //
+    //  Liefert true, wenn das Array ein Element enthaelt, das gleich data
+    //  ist, sonst false.
+    //
+    bool Contains(const T& data) const
+    { return Find(data) != End(); }
+
+    //
+    //  Zerstoert alle Elemente des Arrays. Der reservierte Speicher bleibt
+    //  erhalten.
+    //
+    void Clear();
+
+    //
+    //  Haengt Kopien der Elemente von array an das Ende des Arrays an.
+    //
+    Array<T>& Append(const Array<T>& array);
+
+    //
+    //  Reduziert den reservierten Speicher auf die minimal benoetigte
+    //  Groesse.
+    //
+    void Shrink()
+    { Resize(m_count); }
+
+    //
+    //  Stellt sicher, dass die Kapazitaet des Arrays mindestens size
+    //  betraegt. Die Funktion liefert true, wenn das Array vergroessert
+    //  wurde, sonst false.
+    //
+    bool Reserve(uint size)
+    { return size > m_capacity ? Resize(size) : false; }
+
+    //
+    //  Fuegt eine Kopie von data an der Position pos ein. Die nachfolgenden
+    //  Elemente werden um eine Position nach hinten verschoben. Es muss
+    //  sichergestellt sein, dass pos <= Count() ist.
+    //
+    void Insert(const T& data, uint pos);
+
+    //
+    //  Haengt eine Kopie von data an das Ende des Arrays an.
+    //
+    void Append(const T& data);
+
+    //
+    //  Erzeugt ein neues Element am Ende des Arrays direkt im Speicher des
+    //  Arrays, wobei die Argumente an den Konstruktor von T weitergereicht
+    //  werden. Die Funktion liefert eine Referenz auf das neue Element. Die
+    //  Argumente duerfen keine Elemente des Arrays referenzieren.
+    //
+    T& Emplace()
+    {
+        T* data = new (Slot()) T();
+        ++m_count;
+        return *data;
+    }
+
+    template <class A1>
+    T& Emplace(const A1& a1)
+    {
+        T* data = new (Slot()) T(a1);
+        ++m_count;
+        return *data;
+    }
+
+    template <class A1, class A2>
+    T& Emplace(const A1& a1, const A2& a2)
+    {
+        T* data = new (Slot()) T(a1, a2);
+        ++m_count;
+        return *data;
+    }
+
+    template <class A1, class A2, class A3>
+    T& Emplace(const A1& a1, const A2& a2, const A3& a3)
+    {
+        T* data = new (Slot()) T(a1, a2, a3);
+        ++m_count;
+        return *data;
+    }
+
+    template <class A1, class A2, class A3, class A4>
+    T& Emplace(const A1& a1, const A2& a2, const A3& a3, const A4& a4)
+    {
+        T* data = new (Slot()) T(a1, a2, a3, a4);
+        ++m_count;
+        return *data;
+    }
+
+    //
+    //  Entfernt das Element an der Position pos. Die nachfolgenden Elemente
+    //  werden um eine Position nach vorn verschoben. Es muss sichergestellt
+    //  sein, dass pos < Count() ist.
+    //
+    void Remove(uint pos);
+
+    //
+    //  Entfernt das erste Element, das gleich data ist. Die Funktion liefert
+    //  true, wenn ein Element entfernt wurde, sonst false.
+    //
+    bool Remove(const T& data);
+
+    //
+    //  Entfernt das letzte Element. Das Array darf nicht leer sein.
+    //
+    void RemoveLast()
+    { m_data[--m_count].~T(); }
+
+    //
+    //  Vertauscht die Elemente an den Positionen i und j.
+    //
+    void Swap(uint i, uint j)
+    { ::Swap(m_data[i], m_data[j]); }
+
+    //
+    //  Vertauscht den Inhalt des Arrays mit dem von array, ohne Elemente zu
+    //  kopieren.
+    //
+    void Swap(Array<T>& array);
+
+    //
+    //  Ruft fuer jedes Element des Arrays die Funktion fn auf. Dies muss eine
+    //  Funktion mit einem Parameter vom Typ const T& oder ein entsprechendes
+    //  Funktionsobjekt sein.
+    //
+    template <class Fn> void DoForEach(Fn fn) const;
+
+private:
+
+    //
+    //  Reserviert uninitialisierten Speicher fuer size Elemente. Ist size
+    //  groesser als MAX_CAPACITY, wird eine Exception vom Typ BadAlloc
+    //  ausgeloest, bevor size * sizeof(T) ueberlaufen kann.
+    //
+    static T* Allocate(uint size);
+
+    //
+    //  Verschiebt count Elemente von src in den uninitialisierten Speicher
+    //  dst und zerstoert die Quellelemente.
+    //
+    static void Relocate(T* dst, T* src, uint count);
+
+    //
+    //  Liefert die Adresse des (uninitialisierten) Speicherplatzes hinter dem
+    //  letzten Element. Das Array wird wenn noetig vergroessert. Hat es
+    //  bereits MAX_CAPACITY Elemente, wird eine Exception vom Typ BadAlloc
+    //  ausgeloest. Count() wird nicht veraendert; der Aufrufer erhoeht
+    //  m_count erst, wenn das Element erfolgreich erzeugt wurde.
+    //
+    T* Slot();
+
+    //
+    //  Ersetzt den Speicherblock durch einen neuen der Groesse max(size,
+    //  MIN_CAPACITY), vorausgesetzt, size ist nicht kleiner als Count().
+    //
+    bool Resize(uint size);
+
+    bool Grow();
+
+    uint    m_capacity;
+    uint    m_count;
+    T*      m_data;
+};
+
+//----------------------------------------------------------------------------
+
+template <class T>
+Array<T>::Array(uint capacity)
+    : m_capacity(capacity > MIN_CAPACITY ? capacity : MIN_CAPACITY),
+      m_count(0),
+      m_data(Allocate(m_capacity))
+{}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+Array<T>::Array(const Array<T>& array)
+    : m_capacity(array.m_count > MIN_CAPACITY ? array.m_count : MIN_CAPACITY),
+      m_count(0),
+      m_data(Allocate(m_capacity))
+{
+    Append(array);
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+Array<T>::~Array()
+{
+    Clear();
+    ::operator delete(m_data);
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+Array<T>& Array<T>::operator=(const Array<T>& array)
+{
+    if (this != &array)
+    {
+        Clear();
+        Append(array);
+    }
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+Array<T>& Array<T>::Append(const Array<T>& array)
+{
+    uint count = array.m_count;
+
+    if (count > MAX_CAPACITY - m_count)
+        throw BadAlloc("Array: maximale Kapazitaet erreicht");
+
+    Reserve(m_count + count);
+
+    for (uint i = 0; i < count; ++i)
+    {
+        new (&m_data[m_count]) T(array.m_data[i]);
+        ++m_count;
+    }
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void Array<T>::Clear()
+{
+    for (uint i = 0; i < m_count; ++i)
+        m_data[i].~T();
+
+    m_count = 0;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void Array<T>::Relocate(T* dst, T* src, uint count)
+{
+    for (uint i = 0; i < count; ++i)
+    {
+#if __cplusplus >= 201103L
+        new (&dst[i]) T(static_cast<T&&>(src[i]));
+#else
+        new (&dst[i]) T(src[i]);
+#endif
+        src[i].~T();
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+T* Array<T>::Allocate(uint size)
+{
+    if (size > MAX_CAPACITY)
+        throw BadAlloc("Array: maximale Kapazitaet erreicht");
+
+    return static_cast<T*>(::operator new(size * sizeof(T)));
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+bool Array<T>::Resize(uint size)
+{
+    if (size < MIN_CAPACITY)
+        size = MIN_CAPACITY;
+
+    if (size == m_capacity || size < m_count)
+        return false;
+
+    T* new_data = Allocate(size);
+    Relocate(new_data, m_data, m_count);
+
+    ::operator delete(m_data);
+    m_data = new_data;
+    m_capacity = size;
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+bool Array<T>::Grow()
+{
+    if (m_capacity == MAX_CAPACITY)
+        return false;
+
+    uint new_size = m_capacity + m_capacity / 2;
+
+    if (new_size > MAX_CAPACITY || new_size < m_capacity)
+        new_size = MAX_CAPACITY;
+
+    return Resize(new_size);
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+T* Array<T>::Slot()
+{
+    if (m_capacity <= m_count && !Grow())
+        throw BadAlloc("Array: maximale Kapazitaet erreicht");
+
+    return &m_data[m_count];
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void Array<T>::Insert(const T& data, uint pos)
+{
+    if (pos == m_count)
+    {
+        Append(data);
+        return;
+    }
+
+    //  data koennte ein Element dieses Arrays sein und durch das Verschieben
+    //  ueberschrieben werden.
+    T value(data);
+    T* slot = Slot();
+
+    new (slot) T(slot[-1]);
+    ++m_count;
+
+    for (uint i = m_count - 2; i > pos; --i)
+        m_data[i] = m_data[i - 1];
+
+    m_data[pos] = value;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void Array<T>::Append(const T& data)
+{
+    if (m_capacity > m_count)
+    {
+        new (&m_data[m_count]) T(data);
+        ++m_count;
+    }
+    else
+    {
+        T value(data);
+        new (Slot()) T(value);
+        ++m_count;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void Array<T>::Remove(uint pos)
+{
+    for (uint i = pos + 1; i < m_count; ++i)
+        m_data[i - 1] = m_data[i];
+
+    m_data[--m_count].~T();
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+bool Array<T>::Remove(const T& data)
+{
+    uint p = Find(data);
+
+    if (p == End())
+        return false;
+
+    Remove(p);
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+uint Array<T>::FindNext(const T& data, uint pos) const
+{
+    uint p;
+
+    for (p = pos; p < m_count; ++p)
+    {
+        if (m_data[p] == data)
+            break;
+    }
+
+    return p;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void Array<T>::Swap(Array<T>& array)
+{
+    ::Swap(m_capacity, array.m_capacity);
+    ::Swap(m_count, array.m_count);
+    ::Swap(m_data, array.m_data);
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+template <class Fn>
+void Array<T>::DoForEach(Fn fn) const
+{
+    for (uint i = 0; i < m_count; ++i)
+        fn(m_data[i]);
+}
+
+//----------------------------------------------------------------------------
+
+#endif
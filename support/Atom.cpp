@@ -0,0 +1,238 @@
+#include "support/Atom.h"
+#include "support/Atomic.h"
+#include "support/Hash.h"
+#include "support/Lock.h"
+#include "support/Utilities.h"
+
+#include <cstring>
+#include <new>
+
+//----------------------------------------------------------------------------
+
+const AtomEntry _empty_atom = { 0, 0, 0, "" };
+
+//----------------------------------------------------------------------------
+//
+//  Hash-Tabelle mit offener Adressierung, die alle Atome enthaelt.
+//
+//  Leser laden die aktuelle Tabelle und ihre Eintraege mit Acquire-
+//  Semantik und benoetigen keine Sperre. Schreiber belegen m_lock, suchen
+//  erneut und tragen den neuen Eintrag mit Release-Semantik ein, nachdem er
+//  vollstaendig initialisiert ist. Beim Vergroessern wird eine neue Tabelle
+//  aufgebaut und erst danach veroeffentlicht. Die alte Tabelle wird nicht
+//  freigegeben, weil Leser noch darauf zugreifen koennen; da die Tabelle
+//  sich jeweils verdoppelt, belegen alle alten Tabellen zusammen hoechstens
+//  so viel Speicher wie die aktuelle.
+//
+//  Findet ein Leser einen Namen in einer veralteten Tabelle nicht, sucht
+//  Insert() unter der Sperre in der aktuellen Tabelle noch einmal.
+//
+struct AtomSlots
+{
+    uint                        mask;
+    Atomic<const AtomEntry*>*   slots;
+    AtomSlots*                  previous;
+};
+
+class AtomTable
+{
+public:
+
+    enum { INITIAL_SIZE = 64 };
+
+    AtomTable()
+        : m_slots(CreateSlots(INITIAL_SIZE)), m_count(0) {}
+
+    const AtomEntry* Lookup(const StringRef& name, uint hash) const;
+    const AtomEntry* Insert(const StringRef& name, uint hash);
+
+    uint Count() const
+    { return m_count.Load(MEMORY_ORDER_RELAXED); }
+
+private:
+
+    AtomTable(const AtomTable&);
+    AtomTable& operator=(const AtomTable&);
+
+    static AtomSlots* CreateSlots(uint size);
+    static const AtomEntry* Probe(const AtomSlots* slots,
+                                  const StringRef& name, uint hash,
+                                  uint* index);
+
+    void Grow();
+
+    Atomic<AtomSlots*>  m_slots;
+    Atomic<uint>        m_count;
+    SpinLock            m_lock;
+};
+
+//----------------------------------------------------------------------------
+
+AtomSlots* AtomTable::CreateSlots(uint size)
+{
+    AtomSlots* slots = new AtomSlots;
+
+    slots->mask = size - 1;
+    slots->slots = new Atomic<const AtomEntry*>[size];
+    slots->previous = nullptr;
+
+    return slots;
+}
+
+//----------------------------------------------------------------------------
+//
+//  Sucht name in slots. Ist name nicht enthalten, wird nullptr geliefert
+//  und in index die Position des freien Platzes gespeichert, an der die
+//  Suche endete.
+//
+const AtomEntry* AtomTable::Probe(const AtomSlots* slots,
+                                  const StringRef& name, uint hash,
+                                  uint* index)
+{
+    uint i = hash & slots->mask;
+
+    for (;;)
+    {
+        const AtomEntry* entry = slots->slots[i].Load(MEMORY_ORDER_ACQUIRE);
+
+        if (entry == nullptr)
+        {
+            *index = i;
+            return nullptr;
+        }
+
+        if (entry->hash == hash && entry->length == name.Length()
+            && memcmp(entry->name, name.Data(), name.Length()) == 0)
+            return entry;
+
+        i = (i + 1) & slots->mask;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+const AtomEntry* AtomTable::Lookup(const StringRef& name, uint hash) const
+{
+    uint index;
+    return Probe(m_slots.Load(MEMORY_ORDER_ACQUIRE), name, hash, &index);
+}
+
+//----------------------------------------------------------------------------
+
+const AtomEntry* AtomTable::Insert(const StringRef& name, uint hash)
+{
+    SpinLocker locker(m_lock);
+
+    uint index;
+    AtomSlots* slots = m_slots.Load(MEMORY_ORDER_RELAXED);
+    const AtomEntry* found = Probe(slots, name, hash, &index);
+
+    if (found != nullptr)
+        return found;
+
+    //  Die Tabelle wird hoechstens zu drei Vierteln gefuellt, damit die
+    //  Suchketten kurz bleiben.
+
+    uint count = m_count.Load(MEMORY_ORDER_RELAXED) + 1;
+
+    if (count * 4 > (slots->mask + 1) * 3)
+    {
+        Grow();
+        slots = m_slots.Load(MEMORY_ORDER_RELAXED);
+        Probe(slots, name, hash, &index);
+    }
+
+    void* memory = ::operator new(sizeof(AtomEntry) + name.Length());
+    AtomEntry* entry = static_cast<AtomEntry*>(memory);
+
+    entry->id = count;
+    entry->length = name.Length();
+    entry->hash = hash;
+    memcpy(entry->name, name.Data(), name.Length());
+    entry->name[name.Length()] = '\0';
+
+    slots->slots[index].Store(entry, MEMORY_ORDER_RELEASE);
+    m_count.Store(count, MEMORY_ORDER_RELAXED);
+
+    return entry;
+}
+
+//----------------------------------------------------------------------------
+
+void AtomTable::Grow()
+{
+    AtomSlots* old_slots = m_slots.Load(MEMORY_ORDER_RELAXED);
+    AtomSlots* new_slots = CreateSlots((old_slots->mask + 1) * 2);
+
+    for (uint i = 0; i <= old_slots->mask; ++i)
+    {
+        const AtomEntry* entry =
+            old_slots->slots[i].Load(MEMORY_ORDER_RELAXED);
+
+        if (entry == nullptr)
+            continue;
+
+        uint j = entry->hash & new_slots->mask;
+
+        while (new_slots->slots[j].Load(MEMORY_ORDER_RELAXED) != nullptr)
+            j = (j + 1) & new_slots->mask;
+
+        new_slots->slots[j].Store(entry, MEMORY_ORDER_RELAXED);
+    }
+
+    new_slots->previous = old_slots;
+    m_slots.Store(new_slots, MEMORY_ORDER_RELEASE);
+}
+
+//----------------------------------------------------------------------------
+//
+//  Die Tabelle wird beim ersten Gebrauch angelegt, damit Atome auch in
+//  Konstruktoren statischer Objekte anderer Uebersetzungseinheiten erzeugt
+//  werden koennen.
+//
+static AtomTable& Table()
+{
+    static AtomTable table;
+    return table;
+}
+
+//----------------------------------------------------------------------------
+
+const AtomEntry* Atom::Intern(const StringRef& name)
+{
+    if (name.Length() == 0)
+        return &_empty_atom;
+
+    uint hash = HashBuffer(name.Data(), name.Length());
+    AtomTable& table = Table();
+    const AtomEntry* entry = table.Lookup(name, hash);
+
+    return entry != nullptr ? entry : table.Insert(name, hash);
+}
+
+//----------------------------------------------------------------------------
+
+bool Atom::Find(const StringRef& name, Atom* atom)
+{
+    const AtomEntry* entry = &_empty_atom;
+
+    if (name.Length() != 0)
+    {
+        entry = Table().Lookup(name, HashBuffer(name.Data(), name.Length()));
+
+        if (entry == nullptr)
+            return false;
+    }
+
+    *atom = Atom(entry);
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+uint Atom::Count()
+{
+    return Table().Count();
+}
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,174 @@
+#ifndef support_Atom_h
+#define support_Atom_h
+
+#include "support/Hash.h"
+#include "support/StringRef.h"
+#include "support/Utilities.h"
+
+//----------------------------------------------------------------------------
+//
+//  Interner Eintrag der Atom-Tabelle. Eintraege werden nie geloescht; name
+//  wird bei der Erzeugung auf length + 1 Zeichen verlaengert.
+//
+struct AtomEntry
+{
+    uint    id;
+    uint    length;
+    uint    hash;
+    char    name[1];
+};
+
+extern const AtomEntry _empty_atom;
+
+//----------------------------------------------------------------------------
+//
+//  Eindeutiger Bezeichner fuer eine Zeichenkette.
+//
+//  Alle Atome mit derselben Zeichenkette verweisen auf denselben Eintrag
+//  einer globalen Tabelle. Der Vergleich zweier Atome ist daher ein
+//  Zeigervergleich, und ein Atom kann ohne Speicheranforderung kopiert
+//  werden. Die Eintraege bleiben bis zum Programmende erhalten; Atome
+//  eignen sich deshalb fuer eine begrenzte Menge von Namen wie die
+//  Feldbezeichner von Messages, nicht fuer beliebige Benutzerdaten.
+//
+//  Die Tabelle kann in mehreren Threads gleichzeitig verwendet werden. Das
+//  Nachschlagen einer bereits bekannten Zeichenkette kommt ohne Sperre aus;
+//  nur das Eintragen neuer Zeichenketten ist durch eine Sperre geschuetzt.
+//  Wer denselben Namen oft verwendet, sollte das Atom einmal erzeugen und
+//  aufbewahren.
+//
+class Atom
+{
+public:
+
+    //
+    //  Erzeugt das Atom der leeren Zeichenkette.
+    //
+    Atom()
+        : m_entry(&_empty_atom) {}
+
+    //
+    //  Liefert das Atom der Zeichenkette name und traegt sie bei Bedarf in
+    //  die Tabelle ein.
+    //
+    Atom(const char* name)
+        : m_entry(Intern(StringRef(name))) {}
+
+    Atom(const StringRef& name)
+        : m_entry(Intern(name)) {}
+
+    //
+    //  Liefert die Zeichenkette des Atoms. Der Zeiger bleibt bis zum
+    //  Programmende gueltig.
+    //
+    const char* Name() const
+    { return m_entry->name; }
+
+    //
+    //  Liefert die Laenge der Zeichenkette.
+    //
+    uint Length() const
+    { return m_entry->length; }
+
+    //
+    //  Liefert eine fortlaufende Nummer des Atoms. Das Atom der leeren
+    //  Zeichenkette hat die Nummer 0, die uebrigen werden in der Reihenfolge
+    //  ihrer Erzeugung ab 1 nummeriert.
+    //
+    uint Id() const
+    { return m_entry->id; }
+
+    //
+    //  Liefert einen Verweis auf die Zeichenkette.
+    //
+    operator StringRef() const
+    { return StringRef(m_entry->name, m_entry->length); }
+
+    //
+    //  Liefert true, wenn name in der Tabelle steht, und speichert dann das
+    //  zugehoerige Atom in atom. Im Gegensatz zum Konstruktor wird name
+    //  nicht eingetragen.
+    //
+    static bool Find(const StringRef& name, Atom* atom);
+
+    //
+    //  Liefert die Anzahl der eingetragenen Zeichenketten.
+    //
+    static uint Count();
+
+private:
+
+    explicit Atom(const AtomEntry* entry)
+        : m_entry(entry) {}
+
+    static const AtomEntry* Intern(const StringRef& name);
+
+    const AtomEntry* m_entry;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Name fuer Suchfunktionen, die Eintraege anhand eines Atoms finden.
+//
+//  Eine Zeichenkette wird dabei nur mit Atom::Find() nachgeschlagen und
+//  nicht in die Tabelle eingetragen: Ein Name, zu dem es noch kein Atom
+//  gibt, kann auch nirgends gespeichert sein, IsKnown() liefert dann false
+//  und die Suche kann sofort erfolglos enden. So wachsen die Tabelle und
+//  ihre Sperre nicht durch Suchen nach unbekannten Namen.
+//
+class AtomLookup
+{
+public:
+
+    AtomLookup(const Atom& atom)
+        : m_atom(atom), m_known(true) {}
+
+    AtomLookup(const char* name)
+        : m_known(Atom::Find(StringRef(name), &m_atom)) {}
+
+    AtomLookup(const StringRef& name)
+        : m_known(Atom::Find(name, &m_atom)) {}
+
+    //
+    //  Liefert true, wenn es zu dem Namen ein Atom gibt.
+    //
+    bool IsKnown() const
+    { return m_known; }
+
+    //
+    //  Liefert das Atom des Namens. Nur gueltig, wenn IsKnown() true ist.
+    //
+    const Atom& Get() const
+    { return m_atom; }
+
+private:
+
+    Atom    m_atom;
+    bool    m_known;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Vergleicht zwei Atome. Da jede Zeichenkette genau einen Eintrag hat,
+//  genuegt der Vergleich der Zeiger.
+//
+inline bool operator==(const Atom& atom1, const Atom& atom2)
+{ return atom1.Name() == atom2.Name(); }
+
+inline bool operator!=(const Atom& atom1, const Atom& atom2)
+{ return atom1.Name() != atom2.Name(); }
+
+//----------------------------------------------------------------------------
+//
+//  Hash-Spezialisierung fuer Atome.
+//
+template <>
+struct DefaultHash<Atom>
+{
+    uint operator()(const Atom& key) const
+    { return HashMix(key.Id()); }
+};
+
+//----------------------------------------------------------------------------
+
+#endif
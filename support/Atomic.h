@@ -0,0 +1,138 @@
+#ifndef support_Atomic_h
+#define support_Atomic_h
+
+#include "support/Utilities.h"
+
+//----------------------------------------------------------------------------
+//
+//  Speicherordnung fuer atomare Operationen. Die Werte entsprechen den
+//  gleichnamigen Konstanten des C++11-Speichermodells.
+//
+enum MemoryOrder
+{
+    MEMORY_ORDER_RELAXED    = __ATOMIC_RELAXED,
+    MEMORY_ORDER_ACQUIRE    = __ATOMIC_ACQUIRE,
+    MEMORY_ORDER_RELEASE    = __ATOMIC_RELEASE,
+    MEMORY_ORDER_ACQ_REL    = __ATOMIC_ACQ_REL,
+    MEMORY_ORDER_SEQ_CST    = __ATOMIC_SEQ_CST
+};
+
+//----------------------------------------------------------------------------
+//
+//  Speicherbarriere mit der Ordnung order.
+//
+inline void AtomicThreadFence(MemoryOrder order = MEMORY_ORDER_SEQ_CST)
+{
+    __atomic_thread_fence(order);
+}
+
+//----------------------------------------------------------------------------
+//
+//  Signalisiert dem Prozessor, dass der aktuelle Thread in einer
+//  Warteschleife auf eine Aenderung durch einen anderen Thread wartet.
+//
+inline void CpuRelax()
+{
+#if defined(__i386__) || defined(__x86_64__)
+    __builtin_ia32_pause();
+#endif
+}
+
+//----------------------------------------------------------------------------
+//
+//  Template-Klasse fuer Variablen, auf die mehrere Threads gleichzeitig
+//  zugreifen.
+//
+//  T muss ein ganzzahliger Typ oder ein Zeigertyp sein, dessen Groesse die
+//  Plattform atomar verarbeiten kann. Alle Operationen verwenden die
+//  atomaren Builtins des Compilers; die Speicherordnung kann fuer jede
+//  Operation angegeben werden und ist standardmaessig sequentiell
+//  konsistent.
+//
+//  FetchAdd() und FetchSub() duerfen nur fuer ganzzahlige Typen verwendet
+//  werden.
+//
+template <class T>
+class Atomic
+{
+public:
+
+    //
+    //  Erzeugt die Variable mit dem Wert value. Die Initialisierung selbst
+    //  ist nicht atomar.
+    //
+    Atomic(T value = T())
+        : m_value(value) {}
+
+    //
+    //  Liefert den aktuellen Wert.
+    //
+    T Load(MemoryOrder order = MEMORY_ORDER_SEQ_CST) const
+    { return __atomic_load_n(&m_value, order); }
+
+    //
+    //  Setzt den Wert auf value.
+    //
+    void Store(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST)
+    { __atomic_store_n(&m_value, value, order); }
+
+    //
+    //  Setzt den Wert auf value und liefert den vorherigen Wert.
+    //
+    T Exchange(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST)
+    { return __atomic_exchange_n(&m_value, value, order); }
+
+    //
+    //  Setzt den Wert auf desired, wenn er gleich expected ist, und liefert
+    //  true. Andernfalls wird der aktuelle Wert in expected gespeichert und
+    //  die Funktion liefert false. Im Fehlerfall gilt die staerkste fuer
+    //  einen Lesezugriff zulaessige Ordnung, die order nicht uebersteigt.
+    //
+    bool CompareExchange(T& expected, T desired,
+                         MemoryOrder order = MEMORY_ORDER_SEQ_CST)
+    {
+        return __atomic_compare_exchange_n(&m_value, &expected, desired,
+                                           false, order, FailureOrder(order));
+    }
+
+    //
+    //  Addiert bzw. subtrahiert value und liefert den vorherigen Wert.
+    //
+    T FetchAdd(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST)
+    { return __atomic_fetch_add(&m_value, value, order); }
+
+    T FetchSub(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST)
+    { return __atomic_fetch_sub(&m_value, value, order); }
+
+    //
+    //  Verknuepft den Wert bitweise mit value und liefert den vorherigen
+    //  Wert.
+    //
+    T FetchAnd(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST)
+    { return __atomic_fetch_and(&m_value, value, order); }
+
+    T FetchOr(T value, MemoryOrder order = MEMORY_ORDER_SEQ_CST)
+    { return __atomic_fetch_or(&m_value, value, order); }
+
+private:
+
+    Atomic(const Atomic<T>&);
+    Atomic<T>& operator=(const Atomic<T>&);
+
+    static MemoryOrder FailureOrder(MemoryOrder order)
+    {
+        if (order == MEMORY_ORDER_ACQ_REL)
+            return MEMORY_ORDER_ACQUIRE;
+
+        if (order == MEMORY_ORDER_RELEASE)
+            return MEMORY_ORDER_RELAXED;
+
+        return order;
+    }
+
+    T m_value;
+};
+
+//----------------------------------------------------------------------------
+
+#endif
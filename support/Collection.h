@@ -1,6 +1,171 @@
 #ifndef support_Collection_h
 #define support_Collection_h
 
+#include "support/Utilities.h"
+
+#include <cstring>
+
+//----------------------------------------------------------------------------
+//
+//  Ownership-Strategien fuer Collections.
+//
+//  Ueber den Template-Parameter Ownership wird festgelegt, wie eine
+//  Collection mit ihren Elementen umgeht. Die Strategie wird zur
+//  Uebersetzungszeit aufgeloest, so dass beim Einfuegen, Kopieren und
+//  Entfernen keine virtuellen Funktionsaufrufe pro Element anfallen.
+//
+//  DynamicOwnership:   Das bisherige Verhalten (Standardvorgabe). Ob
+//                      Elemente geloescht werden, wird zur Laufzeit mit
+//                      SetAutoDelete() festgelegt, NewItem() und
+//                      DeleteItem() koennen ueberschrieben werden.
+//
+//  SharedOwnership:    Die Collection speichert nur Zeiger und loescht nie
+//                      Elemente. Kopieren und Leeren der Collection
+//                      reduziert sich auf memcpy() bzw. das Zuruecksetzen
+//                      des Zaehlers.
+//
+//  ExclusiveOwnership: Die Collection uebernimmt die eingefuegten Objekte
+//                      und loescht sie mit delete, wenn sie entfernt werden.
+//                      Solche Collections koennen einander nicht zugewiesen
+//                      oder aneinander angehaengt werden, da die Elemente
+//                      sonst doppelt geloescht wuerden. Entsprechende
+//                      Aufrufe werden bei der Uebersetzung abgewiesen.
+//
+//  CopyOwnership:      Die Collection speichert Kopien der eingefuegten
+//                      Objekte (deep copy) und loescht diese, wenn sie
+//                      entfernt werden. T muss einen Kopierkonstruktor
+//                      besitzen.
+//
+template <class T>
+struct DynamicOwnership {};
+
+template <class T>
+struct SharedOwnership
+{
+    enum { COPIES_ITEMS = false, DELETES_ITEMS = false };
+
+    static T* NewItem(T* data)
+    { return data; }
+
+    static void DeleteItem(T*) {}
+};
+
+template <class T>
+struct ExclusiveOwnership
+{
+    enum { COPIES_ITEMS = false, DELETES_ITEMS = true };
+
+    static T* NewItem(T* data)
+    { return data; }
+
+    static void DeleteItem(T* data)
+    { delete data; }
+};
+
+template <class T>
+struct CopyOwnership
+{
+    enum { COPIES_ITEMS = true, DELETES_ITEMS = true };
+
+    static T* NewItem(T* data)
+    { return new T(*data); }
+
+    static void DeleteItem(T* data)
+    { delete data; }
+};
+
+//----------------------------------------------------------------------------
+//
+//  Basisklasse fuer alle Collections (Container) mit statischer Ownership-
+//  Strategie.
+//
+//  Die Funktionen NewItem() und DeleteItem() werden direkt an die Strategie
+//  Ownership weitergeleitet und koennen vom Compiler vollstaendig inline
+//  expandiert werden. NewItems() und DeleteItems() bearbeiten ganze Bloecke
+//  von Elementen, so dass z.B. das Kopieren eines Vektors mit
+//  SharedOwnership zu einem einzigen memcpy() wird.
+//
+template <class T, class Ownership = DynamicOwnership<T> >
+class Collection
+{
+protected:
+
+    //
+    //  Erstellt eine Collection.
+    //
+    Collection() {}
+
+    //
+    //  Zerstoert eine Collection.
+    //
+    virtual ~Collection() {}
+
+    //
+    //  Erstellt ein neues Datenelement gemaess der Ownership-Strategie.
+    //
+    T* NewItem(T* data)
+    { return Ownership::NewItem(data); }
+
+    //
+    //  Loescht ein Datenelement gemaess der Ownership-Strategie.
+    //
+    void DeleteItem(T* data)
+    { Ownership::DeleteItem(data); }
+
+    //
+    //  Schreibt fuer die count Elemente ab src neue Datenelemente nach dst.
+    //  Die Bereiche duerfen sich nicht ueberlappen.
+    //
+    void NewItems(T** dst, T* const* src, uint count);
+
+    //
+    //  Loescht die count Datenelemente ab data gemaess der Ownership-
+    //  Strategie.
+    //
+    void DeleteItems(T* const* data, uint count);
+
+    //
+    //  Liefert true, wenn die Collection beim Entfernen von Elementen
+    //  DeleteItem() aufrufen muss. Collections koennen so das Durchlaufen
+    //  ihrer Elemente ganz einsparen.
+    //
+    bool DeletesItems() const
+    { return Ownership::DELETES_ITEMS; }
+
+    //
+    //  Wird aufgerufen, bevor die Collection Elemente einer anderen
+    //  Collection uebernimmt. Wuerden die Elemente danach von beiden
+    //  Collections geloescht (ExclusiveOwnership), bricht die Uebersetzung
+    //  hier ab.
+    //
+    static void CheckShareable()
+    {
+        StaticAssert<Ownership::COPIES_ITEMS
+                     || !Ownership::DELETES_ITEMS>::Check();
+    }
+
+    //
+    //  Wird aufgerufen, nachdem der Collection die Elemente einer anderen
+    //  Collection zugewiesen wurden. Bei statischen Strategien ist ausser
+    //  der Pruefung durch CheckShareable() nichts zu tun.
+    //
+    void AssignedFrom()
+    { CheckShareable(); }
+
+private:
+
+    //
+    //  Collections koennen nicht kopiert werden, weil ein ueberschriebenes
+    //  NewItem() nicht von einem Konstruktor aus aufgerufen werden kann.
+    //
+    Collection(const Collection<T, Ownership>&);
+
+    //
+    //  Abstrakte Collections koennen nicht zugewiesen werden.
+    //
+    Collection<T, Ownership>& operator=(const Collection<T, Ownership>&);
+};
+
 //----------------------------------------------------------------------------
 //
 //  Basisklasse fuer alle Collections (Container).
@@ -11,7 +176,7 @@
 //  Collection entfernt werden.
 //
 template <class T>
-class Collection
+class Collection<T, DynamicOwnership<T> >
 {
 public:
 
@@ -68,6 +233,46 @@ protected:
     virtual void DeleteItem(T* data)
     { if (m_autoDelete) delete data; }
 
+    //
+    //  Ruft fuer die count Elemente ab src NewItem() auf und schreibt die
+    //  Ergebnisse nach dst.
+    //
+    void NewItems(T** dst, T* const* src, uint count)
+    {
+        for (uint i = 0; i < count; ++i)
+            dst[i] = NewItem(src[i]);
+    }
+
+    //
+    //  Ruft fuer die count Elemente ab data DeleteItem() auf.
+    //
+    void DeleteItems(T* const* data, uint count)
+    {
+        for (uint i = 0; i < count; ++i)
+            DeleteItem(data[i]);
+    }
+
+    //
+    //  Da DeleteItem() ueberschrieben werden kann, muss es fuer jedes
+    //  entfernte Element aufgerufen werden.
+    //
+    bool DeletesItems() const
+    { return true; }
+
+    //
+    //  Bei dynamischer Strategie wird erst zur Laufzeit ueber AutoDelete
+    //  entschieden; es ist daher nichts zu pruefen.
+    //
+    static void CheckShareable() {}
+
+    //
+    //  Wird aufgerufen, nachdem der Collection die Elemente einer anderen
+    //  Collection zugewiesen wurden. Da nur die Zeiger kopiert wurden, wird
+    //  AutoDelete ausgeschaltet.
+    //
+    void AssignedFrom()
+    { m_autoDelete = false; }
+
 private:
 
     //
@@ -86,4 +291,32 @@ private:
 
 //----------------------------------------------------------------------------
 
+template <class T, class Ownership>
+void Collection<T, Ownership>::NewItems(T** dst, T* const* src, uint count)
+{
+    if (Ownership::COPIES_ITEMS)
+    {
+        for (uint i = 0; i < count; ++i)
+            dst[i] = Ownership::NewItem(src[i]);
+    }
+    else
+    {
+        memcpy(dst, src, count * sizeof(T*));
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+void Collection<T, Ownership>::DeleteItems(T* const* data, uint count)
+{
+    if (Ownership::DELETES_ITEMS)
+    {
+        for (uint i = 0; i < count; ++i)
+            Ownership::DeleteItem(data[i]);
+    }
+}
+
+//----------------------------------------------------------------------------
+
 #endif
@@ -0,0 +1,282 @@
+#ifndef support_ConcurrentDict_h
+#define support_ConcurrentDict_h
+
+#include "support/Collection.h"
+#include "support/Hash.h"
+#include "support/HashTable.h"
+#include "support/Lock.h"
+#include "support/Utilities.h"
+
+#include <new>
+
+//----------------------------------------------------------------------------
+//
+//  Template-Klasse fuer eine Hashtabelle, auf die mehrere Threads
+//  gleichzeitig zugreifen koennen.
+//
+//  Die Eintraege werden anhand der oberen Bits ihres Hashwertes auf
+//  SHARD_COUNT Teiltabellen (HashTable) verteilt, die jeweils durch eine
+//  eigene ReadWriteLock geschuetzt sind. Suchen belegen nur die Lesesperre
+//  ihrer Teiltabelle und schliessen sich daher nicht gegenseitig aus;
+//  Aenderungen sperren nur die betroffene Teiltabelle. Jede Teiltabelle
+//  beginnt auf einer eigenen Cache-Zeile, damit sich die Sperren
+//  verschiedener Teiltabellen nicht gegenseitig verdraengen.
+//
+//  Da auch Leser das Sperrwort ihrer Teiltabelle schreiben, verteilt sich
+//  die Last nur ueber verschiedene Teiltabellen. Suchen viele Threads
+//  gleichzeitig in derselben Teiltabelle, konkurrieren sie um deren
+//  Cache-Zeile (siehe ReadWriteLock).
+//
+//  Die Funktionen entsprechen denen von HashTable. Zu beachten ist, dass
+//  ein von Find() gelieferter Zeiger nicht mehr durch die Sperre geschuetzt
+//  ist: Entfernt und loescht ein anderer Thread das Element, wird der Zeiger
+//  ungueltig. Dies muss der Aufrufer ausschliessen, etwa indem er die
+//  Elemente nicht von der Tabelle loeschen laesst (SharedOwnership).
+//
+template <class Key, class T, class Hash = DefaultHash<Key>,
+          class Ownership = DynamicOwnership<T> >
+class ConcurrentDict
+{
+public:
+
+    static const uint   SHARD_BITS      = 4;
+    static const uint   SHARD_COUNT     = 1 << SHARD_BITS;
+    static const uint   CACHE_LINE_SIZE = 64;
+
+    ConcurrentDict();
+    ~ConcurrentDict();
+
+    //
+    //  Legt fest, ob entfernte Elemente geloescht werden (nur fuer
+    //  DynamicOwnership, siehe Collection::SetAutoDelete()). Die Funktion
+    //  sollte aufgerufen werden, bevor andere Threads auf das Objekt
+    //  zugreifen.
+    //
+    void SetAutoDelete(bool autoDelete);
+
+    //
+    //  Liefert die Anzahl der gespeicherten Elemente. Waehrend andere
+    //  Threads die Tabelle veraendern, ist der Wert nur eine Momentaufnahme.
+    //
+    uint Count() const;
+
+    //
+    //  Liefert einen Zeiger auf das Element mit dem Schluessel key oder 0,
+    //  wenn kein solches Element existiert.
+    //
+    T* operator[](const Key& key) const
+    { return Find(key); }
+
+    //
+    //  Entfernt alle Elemente (siehe HashTable::Clear()).
+    //
+    void Clear();
+
+    //
+    //  Fuegt data unter dem Schluessel key ein (siehe HashTable::Insert()).
+    //
+    bool Insert(const Key& key, T* data);
+
+    //
+    //  Ersetzt das Element mit dem Schluessel key durch data (siehe
+    //  HashTable::Replace()).
+    //
+    void Replace(const Key& key, T* data);
+
+    //
+    //  Entfernt das Element mit dem Schluessel key (siehe
+    //  HashTable::Remove()).
+    //
+    bool Remove(const Key& key);
+
+    //
+    //  Entfernt das Element mit dem Schluessel key ohne es zu loeschen (siehe
+    //  HashTable::Take()).
+    //
+    T* Take(const Key& key);
+
+    //
+    //  Liefert einen Zeiger auf das Element mit dem Schluessel key oder 0,
+    //  wenn kein solches Element existiert.
+    //
+    T* Find(const Key& key) const;
+
+    //
+    //  Ruft fuer jedes Element die Funktion fn auf (siehe
+    //  HashTable::DoForEach()). Jede Teiltabelle ist waehrend des Durchlaufs
+    //  fuer Schreibzugriffe gesperrt; fn darf die Tabelle daher nicht
+    //  veraendern.
+    //
+    template <class Fn> void DoForEach(Fn fn) const;
+
+private:
+
+    ConcurrentDict(const ConcurrentDict<Key, T, Hash, Ownership>&);
+    ConcurrentDict<Key, T, Hash, Ownership>& operator=(
+        const ConcurrentDict<Key, T, Hash, Ownership>&);
+
+    typedef HashTable<Key, T, Hash, Ownership> Table;
+
+    //
+    //  Durch die Ausrichtung ist sizeof(Shard) ein Vielfaches der
+    //  Cache-Zeile. Da new vor C++17 keine erweiterte Ausrichtung beachtet,
+    //  werden die Teiltabellen in m_memory von Hand ausgerichtet.
+    //
+    struct Shard
+    {
+        mutable ReadWriteLock   lock;
+        Table                   table;
+    } __attribute__((aligned(CACHE_LINE_SIZE)));
+
+    //
+    //  Liefert die Teiltabelle fuer den Schluessel key. HashTable verwendet
+    //  die unteren Bits des Hashwertes, die Teiltabelle wird deshalb ueber
+    //  die oberen Bits gewaehlt.
+    //
+    Shard& ShardOf(const Key& key)
+    { return m_shards[HashMix(m_hasher(key)) >> (32 - SHARD_BITS)]; }
+
+    const Shard& ShardOf(const Key& key) const
+    { return m_shards[HashMix(m_hasher(key)) >> (32 - SHARD_BITS)]; }
+
+    char*   m_memory;
+    Shard*  m_shards;
+    Hash    m_hasher;
+};
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+ConcurrentDict<Key, T, Hash, Ownership>::ConcurrentDict()
+    : m_memory(new char[SHARD_COUNT * sizeof(Shard) + CACHE_LINE_SIZE - 1])
+{
+    ulong address = reinterpret_cast<ulong>(m_memory);
+    address = (address + CACHE_LINE_SIZE - 1) & ~ulong(CACHE_LINE_SIZE - 1);
+    m_shards = reinterpret_cast<Shard*>(address);
+
+    for (uint i = 0; i < SHARD_COUNT; ++i)
+        new (&m_shards[i]) Shard;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+ConcurrentDict<Key, T, Hash, Ownership>::~ConcurrentDict()
+{
+    for (uint i = 0; i < SHARD_COUNT; ++i)
+        m_shards[i].~Shard();
+
+    delete[] m_memory;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void ConcurrentDict<Key, T, Hash, Ownership>::SetAutoDelete(bool autoDelete)
+{
+    for (uint i = 0; i < SHARD_COUNT; ++i)
+    {
+        WriteLocker locker(m_shards[i].lock);
+        m_shards[i].table.SetAutoDelete(autoDelete);
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+uint ConcurrentDict<Key, T, Hash, Ownership>::Count() const
+{
+    uint count = 0;
+
+    for (uint i = 0; i < SHARD_COUNT; ++i)
+    {
+        ReadLocker locker(m_shards[i].lock);
+        count += m_shards[i].table.Count();
+    }
+
+    return count;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void ConcurrentDict<Key, T, Hash, Ownership>::Clear()
+{
+    for (uint i = 0; i < SHARD_COUNT; ++i)
+    {
+        WriteLocker locker(m_shards[i].lock);
+        m_shards[i].table.Clear();
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+bool ConcurrentDict<Key, T, Hash, Ownership>::Insert(const Key& key, T* data)
+{
+    Shard& shard = ShardOf(key);
+    WriteLocker locker(shard.lock);
+
+    return shard.table.Insert(key, data);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void ConcurrentDict<Key, T, Hash, Ownership>::Replace(const Key& key, T* data)
+{
+    Shard& shard = ShardOf(key);
+    WriteLocker locker(shard.lock);
+
+    shard.table.Replace(key, data);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+bool ConcurrentDict<Key, T, Hash, Ownership>::Remove(const Key& key)
+{
+    Shard& shard = ShardOf(key);
+    WriteLocker locker(shard.lock);
+
+    return shard.table.Remove(key);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+T* ConcurrentDict<Key, T, Hash, Ownership>::Take(const Key& key)
+{
+    Shard& shard = ShardOf(key);
+    WriteLocker locker(shard.lock);
+
+    return shard.table.Take(key);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+T* ConcurrentDict<Key, T, Hash, Ownership>::Find(const Key& key) const
+{
+    const Shard& shard = ShardOf(key);
+    ReadLocker locker(shard.lock);
+
+    return shard.table.Find(key);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+template <class Fn>
+void ConcurrentDict<Key, T, Hash, Ownership>::DoForEach(Fn fn) const
+{
+    for (uint i = 0; i < SHARD_COUNT; ++i)
+    {
+        ReadLocker locker(m_shards[i].lock);
+        m_shards[i].table.template DoForEach<Fn&>(fn);
+    }
+}
+
+//----------------------------------------------------------------------------
+
+#endif
@@ -3,8 +3,13 @@
 
 #include "support/Collection.h"
 #include "support/Hash.h"
+#include "support/NodePool.h"
 #include "support/Utilities.h"
 
+#ifdef DICT_STATISTICS
+#include "support/DictStatistics.h"
+#endif
+
 //----------------------------------------------------------------------------
 //
 //  Template-Klasse, die eine Hashtabelle bereitstellt.
@@ -29,11 +34,29 @@
 //  Option auf true gesetzt werden. Die Standardvorgabe ist false, d.h. die
 //  Elemente werden nicht geloescht.
 //
-template <class Key, class T, class Hash = DefaultHash<Key> >
-class Dict: public Collection<T>
+//  Alternativ kann ueber den Parameter Ownership eine statische Strategie
+//  (siehe Collection.h) gewaehlt werden.
+//
+//  Mit SetAutoResize() kann das Dictionary angewiesen werden, seine Groesse
+//  selbst anzupassen. Die Eintraege werden dann nicht auf einmal in die
+//  neue Tabelle uebertragen, sondern schrittweise bei jedem Aufruf von
+//  Insert(), Take() und Remove(), so dass keine einzelne Operation die
+//  vollen Kosten der Vergroesserung traegt. Find() und DoForEach() veraendern
+//  das Dictionary nicht und koennen daher gleichzeitig in mehreren Threads
+//  aufgerufen werden, solange kein Thread schreibt.
+//
+//  Ist das Makro DICT_STATISTICS definiert, fuehrt jedes Dictionary eine
+//  Statistik ueber seine Belegung und die Laenge der Suchvorgaenge (siehe
+//  DictStatistics.h).
+//
+template <class Key, class T, class Hash = DefaultHash<Key>,
+          class Ownership = DynamicOwnership<T> >
+class Dict: public Collection<T, Ownership>
 {
 public:
 
+    static const uint   DEFAULT_RESIZE_WORK = 4;
+
     //
     //  Erstelle ein leeres Dictionary der Groesse size. Als Groesse sollte
     //  eine grosse Primzahl gewaehlt werden, um optimale Performance zu
@@ -65,13 +88,49 @@ public:
     uint Count() const
     { return m_count; }
 
+    //
+    //  Schaltet die automatische Groessenanpassung ein oder aus. Ist sie
+    //  eingeschaltet, waechst die Tabelle auf etwa die doppelte Groesse,
+    //  sobald Count() die Groesse der Tabelle erreicht. Waehrend der
+    //  Umstellung bleibt die alte Tabelle bestehen; jeder Aufruf von
+    //  Insert(), Take() und Remove() uebertraegt die Liste des gesuchten
+    //  Schluessels und hoechstens maxWork weitere Listen in die neue
+    //  Tabelle. Ein maxWork von 0 wird wie 1 behandelt, damit jede
+    //  Umstellung abgeschlossen wird, bevor die Tabelle wieder voll ist.
+    //  Find() sucht waehrend der Umstellung in beiden Tabellen. Beim
+    //  Ausschalten wird eine laufende Umstellung abgeschlossen.
+    //
+    void SetAutoResize(bool autoResize,
+                       uint maxWork = DEFAULT_RESIZE_WORK);
+
+    //
+    //  Liefert true, wenn die automatische Groessenanpassung eingeschaltet
+    //  ist.
+    //
+    bool AutoResize() const
+    { return m_autoResize; }
+
+    //
+    //  Setzt den Namen, unter dem das Dictionary in der Statistik erscheint
+    //  (siehe DictStatistics). name muss eine Zeichenkette mit statischer
+    //  Lebensdauer sein. Ohne DICT_STATISTICS hat die Funktion keine
+    //  Wirkung.
+    //
+#ifdef DICT_STATISTICS
+    void SetStatisticsName(const char* name)
+    { m_statistics.SetName(name); }
+#else
+    void SetStatisticsName(const char*) {}
+#endif
+
     //
     //  Weist dem Objekt eine Kopie des Dictionaries dict zu. Dabei werden nur
     //  die Zeiger auf die Elemente kopiert. Ist das Dictionary vorher nicht
     //  leer, werden alle Elemente entfernt und - falls AutoDelete auf true
     //  gesetzt ist - geloescht. Danach wird AutoDelete auf false gesetzt.
     //
-    Dict<Key, T, Hash>& operator=(const Dict<Key, T, Hash>& dict);
+    Dict<Key, T, Hash, Ownership>& operator=(
+        const Dict<Key, T, Hash, Ownership>& dict);
 
     //
     //  Liefert einen Zeiger auf das erste Element mit dem Schluessel key
@@ -108,7 +167,8 @@ public:
     //  liefert true, wenn das Element entfernt wurde, und false, wenn kein
     //  Element unter diesem Schluessel existiert.
     //
-    bool Remove(const Key& key);
+    bool Remove(const Key& key)
+    { return _Remove(key); }
 
     //
     //  Entfernt das zuletzt unter dem Schluessel key eingefuegte Element aus
@@ -116,13 +176,37 @@ public:
     //  gesetzt ist.  Die Funktion liefert einen Zeiger auf das entfernte
     //  Element, oder 0, wenn kein solches Element gefunden wird.
     //
-    T* Take(const Key& key);
+    T* Take(const Key& key)
+    { return _Take(key); }
 
     //
     //  Liefert einen Zeiger auf das erste Element mit dem Schluessel key,
     //  oder 0, wenn kein solches Element existiert.
     //
-    T* Find(const Key& key) const;
+    T* Find(const Key& key) const
+    { return _Find(key); }
+
+    //
+    //  Varianten von Remove(), Take() und Find() fuer Schluessel eines
+    //  anderen Typs K, z.B. const char* oder StringRef in einem Dictionary
+    //  mit String-Schluesseln. Sie stehen nur zur Verfuegung, wenn Hash
+    //  transparent ist (siehe IsTransparentHash), und vergleichen key direkt
+    //  mit den gespeicherten Schluesseln, ohne ein Key-Objekt anzulegen.
+    //
+    template <class K>
+    typename EnableIf<IsTransparentHash<Hash, K>::VALUE, bool>::Type
+    Remove(const K& key)
+    { return _Remove(key); }
+
+    template <class K>
+    typename EnableIf<IsTransparentHash<Hash, K>::VALUE, T*>::Type
+    Take(const K& key)
+    { return _Take(key); }
+
+    template <class K>
+    typename EnableIf<IsTransparentHash<Hash, K>::VALUE, T*>::Type
+    Find(const K& key) const
+    { return _Find(key); }
 
     //
     //  Aendert die Groesse der Hashtabelle auf den Wert von size. Diese
@@ -136,6 +220,9 @@ public:
     //  Der Wert von size sollte eine grosse Primzahl sein, um eine gute
     //  Performance der Struktur zu erzielen.
     //
+    //  Eine laufende schrittweise Umstellung (siehe SetAutoResize()) wird
+    //  vorher abgeschlossen.
+    //
     void Resize(uint size);
 
     //
@@ -151,7 +238,7 @@ private:
     //  Collections koennen nicht kopiert werden, weil ein ueberschriebenes
     //  NewItem() nicht von einem Konstruktor aus aufgerufen werden kann.
     //
-    Dict(const Dict<Key, T, Hash>&);
+    Dict(const Dict<Key, T, Hash, Ownership>&);
 
     struct Node
     {
@@ -166,33 +253,135 @@ private:
     //
     //  Berechnet den Hashwert des Schluessels key.
     //
-    uint Lookup(const Key& key) const
+    template <class K>
+    uint Lookup(const K& key) const
     { return m_hasher(key) % m_size; }
 
     //
     //  Berechnet den Hashwert des Schluessels key fuer eine Tabelle der
     //  Groesse size.
     //
-    uint Lookup(const Key& key, uint size) const
+    template <class K>
+    uint Lookup(const K& key, uint size) const
     { return m_hasher(key) % size; }
 
+    //
+    //  Implementierung von Remove(), Take() und Find() fuer Schluessel vom
+    //  Typ Key oder, bei transparentem Hash, eines verwandten Typs.
+    //
+    template <class K> bool _Remove(const K& key);
+    template <class K> T* _Take(const K& key);
+    template <class K> T* _Find(const K& key) const;
+
     //
     //  Erstellt das Dictionary als Kopie von dict. Diese Funktion loescht
     //  nicht das Array m_nodes!
     //
-    void _Copy(const Dict<Key, T, Hash>& dict);
+    void _Copy(const Dict<Key, T, Hash, Ownership>& dict);
+
+    //
+    //  Legt eine neue, leere Tabelle der Groesse size an. Die bisherige
+    //  Tabelle wird zur alten Tabelle, deren Listen danach schrittweise
+    //  uebertragen werden.
+    //
+    void BeginResize(uint size);
+
+    //
+    //  Haengt die Knotenkette list in umgekehrter Reihenfolge vorne an die
+    //  Listen der neuen Tabelle an. Ist list die umgedrehte Liste eines
+    //  alten Eintrags, stehen die Knoten danach wieder in der
+    //  urspruenglichen Reihenfolge.
+    //
+    void PushReversed(Node* list);
+
+    //
+    //  Uebertraegt die Liste index der alten Tabelle in die neue. Die
+    //  Reihenfolge der Knoten bleibt dabei erhalten.
+    //
+    void MoveBucket(uint index);
+
+    //
+    //  Uebertraegt hoechstens work weitere Listen der alten Tabelle und gibt
+    //  diese frei, sobald sie leer ist.
+    //
+    void Migrate(uint work);
+
+    //
+    //  Uebertraegt die Liste, in der key in der alten Tabelle stehen wuerde,
+    //  sowie m_resizeWork weitere Listen. Danach befinden sich alle Knoten
+    //  mit dem Schluessel key in der neuen Tabelle, so dass die
+    //  Einfuegereihenfolge gleicher Schluessel erhalten bleibt. Die Knoten
+    //  eines Schluessels stehen daher immer alle in derselben Tabelle.
+    //
+    template <class K> void MigrateKey(const K& key);
+
+    //
+    //  Schliesst eine laufende Umstellung ab.
+    //
+    void FinishResize()
+    { if (m_oldNodes) Migrate(m_oldSize); }
 
-    uint    m_size;
-    uint    m_count;
-    Node**  m_nodes;
-    Hash    m_hasher;
+#ifdef DICT_STATISTICS
+    //
+    //  Ermittelt fuer DictStatistics die Belegung beider Tabellen.
+    //
+    class Statistics: public DictStatistics
+    {
+    public:
+
+        Statistics(const Dict<Key, T, Hash, Ownership>* dict)
+            : m_dict(dict) {}
+
+    protected:
+
+        virtual void GetOccupancy(Occupancy& occupancy) const;
+
+    private:
+
+        void AddChains(Occupancy& occupancy, Node* const* nodes,
+                       uint first, uint size) const;
+
+        const Dict<Key, T, Hash, Ownership>* m_dict;
+    };
+
+    friend class Statistics;
+
+    void RecordFind(bool found, uint probes) const
+    { m_statistics.RecordFind(found, probes); }
+
+    void RecordResize()
+    { m_statistics.RecordResize(); }
+#else
+    void RecordFind(bool, uint) const {}
+    void RecordResize() {}
+#endif
+
+    uint            m_size;
+    uint            m_count;
+    Node**          m_nodes;
+    Hash            m_hasher;
+    bool            m_autoResize;
+    uint            m_resizeWork;
+    uint            m_oldSize;
+    Node**          m_oldNodes;
+    uint            m_migrated;
+    NodePool<Node>  m_pool;
+
+#ifdef DICT_STATISTICS
+    mutable Statistics  m_statistics;
+#endif
 };
 
 //----------------------------------------------------------------------------
 
-template <class Key, class T, class Hash>
-Dict<Key, T, Hash>::Dict(int size)
-    : m_size(size), m_count(0), m_nodes(new Node*[size])
+template <class Key, class T, class Hash, class Ownership>
+Dict<Key, T, Hash, Ownership>::Dict(int size)
+    : m_size(size), m_count(0), m_nodes(new Node*[size]),
+      m_autoResize(false), m_resizeWork(DEFAULT_RESIZE_WORK),
+      m_oldSize(0), m_oldNodes(nullptr), m_migrated(0)
+#ifdef DICT_STATISTICS
+      , m_statistics(this)
+#endif
 {
     for (int i = 0; i < size; ++i)
         m_nodes[i] = nullptr;
@@ -200,17 +389,23 @@ Dict<Key, T, Hash>::Dict(int size)
 
 //----------------------------------------------------------------------------
 
-template <class Key, class T, class Hash>
-Dict<Key, T, Hash>::~Dict()
+template <class Key, class T, class Hash, class Ownership>
+Dict<Key, T, Hash, Ownership>::~Dict()
 {
+#ifdef DICT_STATISTICS
+    m_statistics.Unregister();
+#endif
+
     Clear();
     delete[] m_nodes;
 }
 
 //----------------------------------------------------------------------------
 
-template <class Key, class T, class Hash>
-Dict<Key, T, Hash>& Dict<Key, T, Hash>::operator=(const Dict<Key, T, Hash>& dict)
+template <class Key, class T, class Hash, class Ownership>
+Dict<Key, T, Hash, Ownership>&
+Dict<Key, T, Hash, Ownership>::operator=(
+    const Dict<Key, T, Hash, Ownership>& dict)
 {
     if (this != &dict)
     {
@@ -218,7 +413,7 @@ Dict<Key, T, Hash>& Dict<Key, T, Hash>::operator=(const Dict<Key, T, Hash>& dict
         delete[] m_nodes;
 
         _Copy(dict);
-        this->SetAutoDelete(false);
+        this->AssignedFrom();
     }
 
     return *this;
@@ -226,37 +421,62 @@ Dict<Key, T, Hash>& Dict<Key, T, Hash>::operator=(const Dict<Key, T, Hash>& dict
 
 //----------------------------------------------------------------------------
 
-template <class Key, class T, class Hash>
-void Dict<Key, T, Hash>::Clear()
+template <class Key, class T, class Hash, class Ownership>
+void Dict<Key, T, Hash, Ownership>::SetAutoResize(bool autoResize,
+                                                  uint maxWork)
+{
+    if (!autoResize)
+        FinishResize();
+
+    m_autoResize = autoResize;
+    m_resizeWork = Max(maxWork, 1u);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void Dict<Key, T, Hash, Ownership>::Clear()
 {
+    FinishResize();
+
     for (int i = 0; i < m_size; ++i)
     {
         while (m_nodes[i] != nullptr)
         {
             Node* node = m_nodes[i];
             m_nodes[i] = node->next;
-            this->DeleteItem(node->data);
-            delete node;
+
+            if (this->DeletesItems())
+                this->DeleteItem(node->data);
+
+            m_pool.Free(node);
         }
     }
 
     m_count = 0;
+    m_pool.Clear();
 }
 
 //----------------------------------------------------------------------------
 
-template <class Key, class T, class Hash>
-void Dict<Key, T, Hash>::Insert(const Key& key, T* data)
+template <class Key, class T, class Hash, class Ownership>
+void Dict<Key, T, Hash, Ownership>::Insert(const Key& key, T* data)
 {
+    if (m_autoResize && !m_oldNodes && m_count >= m_size)
+        BeginResize(m_size * 2 + 1);
+
+    MigrateKey(key);
+
     uint index = Lookup(key);
-    m_nodes[index] = new Node(key, this->NewItem(data), m_nodes[index]);
+    m_nodes[index] = new (m_pool.Allocate())
+        Node(key, this->NewItem(data), m_nodes[index]);
     ++m_count;
 }
 
 //----------------------------------------------------------------------------
 
-template <class Key, class T, class Hash>
-void Dict<Key, T, Hash>::Replace(const Key& key, T* data)
+template <class Key, class T, class Hash, class Ownership>
+void Dict<Key, T, Hash, Ownership>::Replace(const Key& key, T* data)
 {
     Remove(key);
     Insert(key, data);
@@ -264,10 +484,11 @@ void Dict<Key, T, Hash>::Replace(const Key& key, T* data)
 
 //----------------------------------------------------------------------------
 
-template <class Key, class T, class Hash>
-bool Dict<Key, T, Hash>::Remove(const Key& key)
+template <class Key, class T, class Hash, class Ownership>
+template <class K>
+bool Dict<Key, T, Hash, Ownership>::_Remove(const K& key)
 {
-    T* data = Take(key);
+    T* data = _Take(key);
 
     if (!data)
         return false;
@@ -278,9 +499,12 @@ bool Dict<Key, T, Hash>::Remove(const Key& key)
 
 //----------------------------------------------------------------------------
 
-template <class Key, class T, class Hash>
-T* Dict<Key, T, Hash>::Take(const Key& key)
+template <class Key, class T, class Hash, class Ownership>
+template <class K>
+T* Dict<Key, T, Hash, Ownership>::_Take(const K& key)
 {
+    MigrateKey(key);
+
     Node** node_ptr = &m_nodes[Lookup(key)];
 
     while (*node_ptr != nullptr)
@@ -292,7 +516,7 @@ T* Dict<Key, T, Hash>::Take(const Key& key)
             T* data = node->data;
             *node_ptr = node->next;
 
-            delete node;
+            m_pool.Free(node);
             --m_count;
             return data;
         }
@@ -305,60 +529,157 @@ T* Dict<Key, T, Hash>::Take(const Key& key)
 
 //----------------------------------------------------------------------------
 
-template <class Key, class T, class Hash>
-T* Dict<Key, T, Hash>::Find(const Key& key) const
+template <class Key, class T, class Hash, class Ownership>
+template <class K>
+T* Dict<Key, T, Hash, Ownership>::_Find(const K& key) const
 {
+    //  Waehrend einer Umstellung stehen die Knoten von key entweder alle in
+    //  der neuen oder alle in der alten Tabelle. Bereits uebertragene Listen
+    //  der alten Tabelle sind leer.
+
     Node* node = m_nodes[Lookup(key)];
+    Node* old_node = m_oldNodes ? m_oldNodes[Lookup(key, m_oldSize)] : nullptr;
 
-    while (node != nullptr)
+    uint probes = 0;
+
+    for (;;)
     {
+        if (node == nullptr)
+        {
+            if (old_node == nullptr)
+                break;
+
+            node = old_node;
+            old_node = nullptr;
+        }
+
+        ++probes;
+
         if (node->key == key)
+        {
+            RecordFind(true, probes);
             return node->data;
+        }
 
         node = node->next;
     }
 
+    RecordFind(false, probes);
     return nullptr;
 }
 
 //----------------------------------------------------------------------------
 
-template <class Key, class T, class Hash>
-void Dict<Key, T, Hash>::Resize(uint size)
+template <class Key, class T, class Hash, class Ownership>
+void Dict<Key, T, Hash, Ownership>::Resize(uint size)
 {
-    Node** new_table = new Node*[size];
+    FinishResize();
+    BeginResize(size);
+    FinishResize();
+}
 
-    for (int i = 0; i < size; ++i)
-        new_table[i] = nullptr;
+//----------------------------------------------------------------------------
 
-    for (int i = 0; i < m_size; ++i)
+template <class Key, class T, class Hash, class Ownership>
+void Dict<Key, T, Hash, Ownership>::BeginResize(uint size)
+{
+    RecordResize();
+
+    m_oldNodes = m_nodes;
+    m_oldSize = m_size;
+    m_migrated = 0;
+
+    m_nodes = new Node*[size];
+    m_size = size;
+
+    for (uint i = 0; i < size; ++i)
+        m_nodes[i] = nullptr;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void Dict<Key, T, Hash, Ownership>::PushReversed(Node* list)
+{
+    while (list != nullptr)
     {
-        Node** node_ptr = &m_nodes[i];
+        Node* next = list->next;
 
-        while (*node_ptr != nullptr)
-        {
-            Node* node = *node_ptr;
-            *node_ptr = node->next;
+        uint index = Lookup(list->key);
+        list->next = m_nodes[index];
+        m_nodes[index] = list;
+
+        list = next;
+    }
+}
+
+//----------------------------------------------------------------------------
 
-            int new_index = Lookup(node->key, size);
-            node->next = new_table[new_index];
-            new_table[new_index] = node;
+template <class Key, class T, class Hash, class Ownership>
+void Dict<Key, T, Hash, Ownership>::MoveBucket(uint index)
+{
+    //
+    //  Die Liste wird zuerst umgedreht, damit die Knoten nach dem Einfuegen
+    //  am Anfang der neuen Listen wieder in der urspruenglichen Reihenfolge
+    //  stehen.
+    //
+    Node* reversed = nullptr;
+    Node* node = m_oldNodes[index];
+
+    while (node != nullptr)
+    {
+        Node* next = node->next;
+        node->next = reversed;
+        reversed = node;
+        node = next;
+    }
+
+    m_oldNodes[index] = nullptr;
+    PushReversed(reversed);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void Dict<Key, T, Hash, Ownership>::Migrate(uint work)
+{
+    for (uint i = 0; i < work && m_oldNodes; ++i)
+    {
+        MoveBucket(m_migrated);
+
+        if (++m_migrated == m_oldSize)
+        {
+            delete[] m_oldNodes;
+            m_oldNodes = nullptr;
         }
     }
+}
 
-    delete[] m_nodes;
-    m_nodes = new_table;
-    m_size = size;
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+template <class K>
+void Dict<Key, T, Hash, Ownership>::MigrateKey(const K& key)
+{
+    if (m_oldNodes)
+    {
+        MoveBucket(Lookup(key, m_oldSize));
+        Migrate(m_resizeWork);
+    }
 }
 
 //----------------------------------------------------------------------------
 
-template <class Key, class T, class Hash>
-void Dict<Key, T, Hash>::_Copy(const Dict<Key, T, Hash>& dict)
+template <class Key, class T, class Hash, class Ownership>
+void Dict<Key, T, Hash, Ownership>::_Copy(
+    const Dict<Key, T, Hash, Ownership>& dict)
 {
     m_size = dict.m_size;
     m_count = dict.m_count;
     m_nodes = new Node*[dict.m_size];
+    m_oldNodes = nullptr;
+    m_oldSize = 0;
+    m_migrated = 0;
 
     for (int i = 0; i < m_size; ++i)
     {
@@ -369,7 +690,7 @@ void Dict<Key, T, Hash>::_Copy(const Dict<Key, T, Hash>& dict)
 
         while (src_node != nullptr)
         {
-            Node* new_node = new Node(
+            Node* new_node = new (m_pool.Allocate()) Node(
                 src_node->key, this->NewItem(src_node->data), nullptr);
 
             *new_node_ptr = new_node;
@@ -377,13 +698,30 @@ void Dict<Key, T, Hash>::_Copy(const Dict<Key, T, Hash>& dict)
             src_node = src_node->next;
         }
     }
+
+    //  Laeuft in dict eine Umstellung, werden die noch nicht uebertragenen
+    //  Listen direkt in die neue Tabelle kopiert, ohne dict zu veraendern.
+
+    for (uint i = dict.m_migrated; dict.m_oldNodes && i < dict.m_oldSize; ++i)
+    {
+        Node* reversed = nullptr;
+
+        for (Node* src_node = dict.m_oldNodes[i]; src_node != nullptr;
+             src_node = src_node->next)
+        {
+            reversed = new (m_pool.Allocate()) Node(
+                src_node->key, this->NewItem(src_node->data), reversed);
+        }
+
+        PushReversed(reversed);
+    }
 }
 
 //----------------------------------------------------------------------------
 
-template <class Key, class T, class Hash>
+template <class Key, class T, class Hash, class Ownership>
 template <class Fn>
-void Dict<Key, T, Hash>::DoForEach(Fn fn) const
+void Dict<Key, T, Hash, Ownership>::DoForEach(Fn fn) const
 {
     for (int i = 0; i < m_size; ++i)
     {
@@ -395,8 +733,63 @@ void Dict<Key, T, Hash>::DoForEach(Fn fn) const
             node = node->next;
         }
     }
+
+    for (uint i = m_migrated; m_oldNodes && i < m_oldSize; ++i)
+    {
+        Node* node = m_oldNodes[i];
+
+        while (node != nullptr)
+        {
+            fn(node->key, node->data);
+            node = node->next;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+#ifdef DICT_STATISTICS
+
+template <class Key, class T, class Hash, class Ownership>
+void Dict<Key, T, Hash, Ownership>::Statistics::GetOccupancy(
+    Occupancy& occupancy) const
+{
+    occupancy.size = m_dict->m_size;
+    occupancy.count = m_dict->m_count;
+    occupancy.maxChain = 0;
+
+    for (uint i = 0; i < HISTOGRAM_SIZE; ++i)
+        occupancy.histogram[i] = 0;
+
+    AddChains(occupancy, m_dict->m_nodes, 0, m_dict->m_size);
+
+    if (m_dict->m_oldNodes)
+    {
+        AddChains(occupancy, m_dict->m_oldNodes, m_dict->m_migrated,
+                  m_dict->m_oldSize);
+    }
 }
 
 //----------------------------------------------------------------------------
 
+template <class Key, class T, class Hash, class Ownership>
+void Dict<Key, T, Hash, Ownership>::Statistics::AddChains(
+    Occupancy& occupancy, Node* const* nodes, uint first, uint size) const
+{
+    for (uint i = first; i < size; ++i)
+    {
+        uint length = 0;
+
+        for (Node* node = nodes[i]; node != nullptr; node = node->next)
+            ++length;
+
+        occupancy.maxChain = Max(occupancy.maxChain, length);
+        ++occupancy.histogram[Min(length, HISTOGRAM_SIZE - 1)];
+    }
+}
+
+#endif
+
+//----------------------------------------------------------------------------
+
 #endif
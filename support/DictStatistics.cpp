@@ -0,0 +1,108 @@
+#include "support/DictStatistics.h"
+#include "support/Lock.h"
+#include "support/Utilities.h"
+
+#include <cstdio>
+
+//----------------------------------------------------------------------------
+//
+//  Globale Liste aller lebenden DictStatistics-Objekte. Dictionaries koennen
+//  in verschiedenen Threads angelegt werden, die Liste ist deshalb durch
+//  eine Sperre geschuetzt.
+//
+static DictStatistics* _statistics_list = nullptr;
+static SpinLock _statistics_lock;
+
+//----------------------------------------------------------------------------
+
+DictStatistics::DictStatistics()
+    : m_name("Dict"),
+      m_hits(0),
+      m_hitProbes(0),
+      m_misses(0),
+      m_missProbes(0),
+      m_resizes(0),
+      m_registered(true),
+      m_prev(nullptr)
+{
+    SpinLocker locker(_statistics_lock);
+
+    m_next = _statistics_list;
+
+    if (m_next != nullptr)
+        m_next->m_prev = this;
+
+    _statistics_list = this;
+}
+
+//----------------------------------------------------------------------------
+
+DictStatistics::~DictStatistics()
+{
+    Unregister();
+}
+
+//----------------------------------------------------------------------------
+
+void DictStatistics::Unregister()
+{
+    SpinLocker locker(_statistics_lock);
+
+    if (!m_registered)
+        return;
+
+    m_registered = false;
+
+    if (m_prev != nullptr)
+        m_prev->m_next = m_next;
+    else
+        _statistics_list = m_next;
+
+    if (m_next != nullptr)
+        m_next->m_prev = m_prev;
+}
+
+//----------------------------------------------------------------------------
+
+void DictStatistics::Dump(FILE* file) const
+{
+    Occupancy occupancy;
+    GetOccupancy(occupancy);
+
+    fprintf(file, "%s %p: size %u, count %u, load %.2f, resizes %u\n",
+            m_name, (const void*) this, occupancy.size, occupancy.count,
+            occupancy.size > 0
+                ? double(occupancy.count) / occupancy.size : 0.0,
+            m_resizes);
+
+    fprintf(file, "  chains:");
+
+    for (uint i = 0; i < HISTOGRAM_SIZE; ++i)
+    {
+        fprintf(file, " %u%s:%u", i, i == HISTOGRAM_SIZE - 1 ? "+" : "",
+                occupancy.histogram[i]);
+    }
+
+    fprintf(file, ", max %u\n", occupancy.maxChain);
+
+    ulonglong hits = m_hits.Load(MEMORY_ORDER_RELAXED);
+    ulonglong hit_probes = m_hitProbes.Load(MEMORY_ORDER_RELAXED);
+    ulonglong misses = m_misses.Load(MEMORY_ORDER_RELAXED);
+    ulonglong miss_probes = m_missProbes.Load(MEMORY_ORDER_RELAXED);
+
+    fprintf(file, "  hits %.0f (%.2f probes), misses %.0f (%.2f probes)\n",
+            double(hits), hits > 0 ? double(hit_probes) / hits : 0.0,
+            double(misses), misses > 0 ? double(miss_probes) / misses : 0.0);
+}
+
+//----------------------------------------------------------------------------
+
+void DictStatistics::DumpAll(FILE* file)
+{
+    SpinLocker locker(_statistics_lock);
+
+    for (DictStatistics* p = _statistics_list; p != nullptr; p = p->m_next)
+        p->Dump(file);
+}
+
+//----------------------------------------------------------------------------
@@ -0,0 +1,138 @@
+#ifndef support_DictStatistics_h
+#define support_DictStatistics_h
+
+#include "support/Atomic.h"
+#include "support/Utilities.h"
+
+#include <cstdio>
+
+//----------------------------------------------------------------------------
+//
+//  Laufzeitstatistik fuer Hashtabellen.
+//
+//  Wird das Programm mit dem Makro DICT_STATISTICS uebersetzt, enthaelt
+//  jedes Dict ein DictStatistics-Objekt, das die Suchvorgaenge und
+//  Groessenaenderungen der Tabelle zaehlt. Alle lebenden Objekte werden in
+//  einer globalen Liste gefuehrt und koennen mit DumpAll() ausgegeben
+//  werden, um Tabellen zu finden, die mit einer zu kleinen Groesse angelegt
+//  wurden. Das Makro muss fuer alle Uebersetzungseinheiten gleich gesetzt
+//  sein.
+//
+//  Die Suchzaehler werden atomar erhoeht, weil Dict::Find() gleichzeitig in
+//  mehreren Threads aufgerufen werden darf. Die globale Liste ist durch
+//  eine Sperre geschuetzt, die Tabellen selbst jedoch nicht: Dump() und
+//  DumpAll() durchlaufen die Listen der Tabellen
+//  und lesen die Zaehler ohne Synchronisation. Sie duerfen deshalb nur
+//  aufgerufen werden, waehrend kein anderer Thread eine der erfassten
+//  Tabellen benutzt, in der Regel also aus dem einzigen Thread, der
+//  Dictionaries verwendet.
+//
+class DictStatistics
+{
+public:
+
+    static const uint   HISTOGRAM_SIZE  = 9;
+
+    //
+    //  Belegung einer Tabelle zu einem bestimmten Zeitpunkt. histogram[i]
+    //  ist die Anzahl der Listen mit i Knoten; der letzte Eintrag zaehlt
+    //  alle Listen mit HISTOGRAM_SIZE - 1 oder mehr Knoten.
+    //
+    struct Occupancy
+    {
+        uint    size;
+        uint    count;
+        uint    maxChain;
+        uint    histogram[HISTOGRAM_SIZE];
+    };
+
+    //
+    //  Traegt das Objekt in die globale Liste ein.
+    //
+    DictStatistics();
+
+    //
+    //  Entfernt das Objekt aus der globalen Liste, falls dies nicht schon
+    //  durch Unregister() geschehen ist.
+    //
+    virtual ~DictStatistics();
+
+    //
+    //  Entfernt das Objekt aus der globalen Liste. Die abgeleitete Klasse
+    //  muss die Funktion als Erstes in ihrem Destruktor aufrufen, solange
+    //  GetOccupancy() noch auf eine gueltige Tabelle zugreift; der
+    //  Destruktor von DictStatistics laeuft erst, wenn die Tabelle bereits
+    //  freigegeben ist.
+    //
+    void Unregister();
+
+    //
+    //  Setzt den Namen, unter dem die Tabelle ausgegeben wird. name muss
+    //  eine Zeichenkette mit statischer Lebensdauer sein.
+    //
+    void SetName(const char* name)
+    { m_name = name; }
+
+    //
+    //  Zaehlt einen Suchvorgang, der nach probes Vergleichen erfolgreich
+    //  bzw. erfolglos beendet wurde. Die Funktion kann gleichzeitig in
+    //  mehreren Threads aufgerufen werden; die Zaehler dienen nur der
+    //  Ausgabe, daher genuegt MEMORY_ORDER_RELAXED.
+    //
+    void RecordFind(bool found, uint probes)
+    {
+        if (found)
+        {
+            m_hits.FetchAdd(1, MEMORY_ORDER_RELAXED);
+            m_hitProbes.FetchAdd(probes, MEMORY_ORDER_RELAXED);
+        }
+        else
+        {
+            m_misses.FetchAdd(1, MEMORY_ORDER_RELAXED);
+            m_missProbes.FetchAdd(probes, MEMORY_ORDER_RELAXED);
+        }
+    }
+
+    //
+    //  Zaehlt eine Groessenaenderung der Tabelle.
+    //
+    void RecordResize()
+    { ++m_resizes; }
+
+    //
+    //  Gibt die Statistik der Tabelle in file aus.
+    //
+    void Dump(FILE* file) const;
+
+    //
+    //  Gibt die Statistik aller lebenden Tabellen in file aus (siehe oben
+    //  zur Verwendung aus mehreren Threads).
+    //
+    static void DumpAll(FILE* file = stderr);
+
+protected:
+
+    //
+    //  Ermittelt die aktuelle Belegung der Tabelle.
+    //
+    virtual void GetOccupancy(Occupancy& occupancy) const = 0;
+
+private:
+
+    DictStatistics(const DictStatistics&);
+    DictStatistics& operator=(const DictStatistics&);
+
+    const char*         m_name;
+    Atomic<ulonglong>   m_hits;
+    Atomic<ulonglong>   m_hitProbes;
+    Atomic<ulonglong>   m_misses;
+    Atomic<ulonglong>   m_missProbes;
+    uint                m_resizes;
+    bool                m_registered;
+    DictStatistics*     m_prev;
+    DictStatistics*     m_next;
+};
+
+//----------------------------------------------------------------------------
+
+#endif
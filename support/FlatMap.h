@@ -0,0 +1,477 @@
+#ifndef support_FlatMap_h
+#define support_FlatMap_h
+
+#include "support/Array.h"
+#include "support/Collection.h"
+#include "support/Utilities.h"
+
+//----------------------------------------------------------------------------
+//
+//  Template-Klasse fuer eine sortierte Zuordnung von Schluesseln zu
+//  Elementen.
+//
+//  Ein FlatMap speichert seine Eintraege (Schluessel und Zeiger auf das
+//  Element) nach Schluesseln sortiert in einem einzigen Array. Gesucht wird
+//  binaer, wobei die Suchschleife ohne bedingte Spruenge auskommt: Fuer
+//  ganzzahlige Schluessel uebersetzt der Compiler den Vergleich in einen
+//  bedingten Move. Fuer kleine und mittlere Schluesselmengen, wie die
+//  Kommando-Ids eines Menues, ist das wegen der kompakten Speicherung
+//  schneller als eine Hashtabelle und liefert die Eintraege zudem in
+//  sortierter Reihenfolge.
+//
+//  Einfuegen und Entfernen verschieben die nachfolgenden Eintraege und
+//  benoetigen daher lineare Zeit. Grosse Mengen von Eintraegen sollten
+//  deshalb mit Assign() in einem Schritt uebernommen werden.
+//
+//  Jeder Schluessel kann nur einmal vorkommen. Fuer Key muss der Operator
+//  "<" definiert sein; zwei Schluessel gelten als gleich, wenn keiner
+//  kleiner als der andere ist.
+//
+//  Wie bei allen Collections wird das Kopieren und Loeschen der Elemente
+//  ueber AutoDelete bzw. den Parameter Ownership (siehe Collection.h)
+//  gesteuert.
+//
+template <class Key, class T, class Ownership = DynamicOwnership<T> >
+class FlatMap: public Collection<T, Ownership>
+{
+public:
+
+    //
+    //  Erstellt eine leere Zuordnung mit Platz fuer capacity Eintraege.
+    //
+    explicit FlatMap(uint capacity = Array<Entry>::INITIAL_CAPACITY)
+        : m_entries(capacity) {}
+
+    //
+    //  Entfernt alle Elemente und zerstoert das Objekt. Ist AutoDelete auf
+    //  true gesetzt, werden die Elemente geloescht.
+    //
+    virtual ~FlatMap()
+    { Clear(); }
+
+    //
+    //  Weist dem Objekt eine Kopie von map zu. Dabei werden nur die Zeiger
+    //  auf die Elemente kopiert. Vorhandene Elemente werden entfernt und -
+    //  falls AutoDelete auf true gesetzt ist - geloescht. Danach wird
+    //  AutoDelete auf false gesetzt.
+    //
+    FlatMap<Key, T, Ownership>& operator=(
+        const FlatMap<Key, T, Ownership>& map);
+
+    //
+    //  Liefert die Anzahl der Eintraege.
+    //
+    uint Count() const
+    { return m_entries.Count(); }
+
+    //
+    //  Liefert die Position des ersten Eintrags.
+    //
+    uint Begin() const
+    { return 0; }
+
+    //
+    //  Liefert die Position hinter dem letzten Eintrag.
+    //
+    uint End() const
+    { return m_entries.Count(); }
+
+    //
+    //  Liefern den Schluessel bzw. das Element des Eintrags an der Position
+    //  pos. Die Eintraege sind aufsteigend nach Schluesseln sortiert. pos
+    //  wird nicht auf Gueltigkeit geprueft.
+    //
+    const Key& KeyAt(uint pos) const
+    { return m_entries[pos].key; }
+
+    T* At(uint pos) const
+    { return m_entries[pos].data; }
+
+    //
+    //  Liefert einen Zeiger auf das Element mit dem Schluessel key oder 0,
+    //  wenn kein solches Element existiert. Dieser Operator entspricht der
+    //  Funktion Find().
+    //
+    T* operator[](const Key& key) const
+    { return Find(key); }
+
+    //
+    //  Liefert einen Zeiger auf das Element mit dem Schluessel key oder 0,
+    //  wenn kein solches Element existiert.
+    //
+    T* Find(const Key& key) const;
+
+    //
+    //  Liefert die Position des ersten Eintrags, dessen Schluessel nicht
+    //  kleiner als key ist, bzw. End().
+    //
+    uint LowerBound(const Key& key) const;
+
+    //
+    //  Liefert die Position des ersten Eintrags, dessen Schluessel groesser
+    //  als key ist, bzw. End(). Alle Eintraege mit Schluesseln im Bereich
+    //  [first, last] liegen an den Positionen LowerBound(first) bis
+    //  UpperBound(last) - 1.
+    //
+    uint UpperBound(const Key& key) const;
+
+    //
+    //  Entfernt alle Eintraege. Ist AutoDelete auf true gesetzt, werden die
+    //  Elemente geloescht.
+    //
+    void Clear();
+
+    //
+    //  Fuegt data unter dem Schluessel key ein und liefert true. Existiert
+    //  bereits ein Eintrag mit diesem Schluessel, wird nichts veraendert und
+    //  die Funktion liefert false.
+    //
+    bool Insert(const Key& key, T* data);
+
+    //
+    //  Ersetzt das Element mit dem Schluessel key durch data. Ist AutoDelete
+    //  auf true gesetzt, wird das alte Element geloescht. Existiert kein
+    //  Eintrag mit diesem Schluessel, wird data neu eingefuegt.
+    //
+    void Replace(const Key& key, T* data);
+
+    //
+    //  Ersetzt den Inhalt durch die count Eintraege (keys[i], data[i]). Die
+    //  Eingabe muss nicht sortiert sein; sie wird einmal stabil sortiert.
+    //  Kommt ein Schluessel mehrfach vor, gilt der letzte Eintrag; die
+    //  uebrigen Elemente werden wie beim Entfernen behandelt.
+    //
+    void Assign(const Key* keys, T* const* data, uint count);
+
+    //
+    //  Entfernt das Element mit dem Schluessel key. Ist AutoDelete auf true
+    //  gesetzt, wird das Element geloescht. Die Funktion liefert true, wenn
+    //  ein Element entfernt wurde, sonst false.
+    //
+    bool Remove(const Key& key);
+
+    //
+    //  Entfernt das Element mit dem Schluessel key, ohne es zu loeschen, und
+    //  liefert einen Zeiger darauf oder 0, wenn kein solches Element
+    //  existiert.
+    //
+    T* Take(const Key& key);
+
+    //
+    //  Ruft fuer jeden Eintrag in aufsteigender Reihenfolge der Schluessel
+    //  die Funktion fn auf. Dies muss eine Funktion mit zwei Parametern der
+    //  Typen Key und T* oder ein entsprechendes Funktionsobjekt sein.
+    //
+    template <class Fn> void DoForEach(Fn fn) const;
+
+private:
+
+    //
+    //  Collections koennen nicht kopiert werden, weil ein ueberschriebenes
+    //  NewItem() nicht von einem Konstruktor aus aufgerufen werden kann.
+    //
+    FlatMap(const FlatMap<Key, T, Ownership>&);
+
+    struct Entry
+    {
+        Entry(const Key& key, T* data)
+            : key(key), data(data) {}
+
+        Key     key;
+        T*      data;
+    };
+
+    //
+    //  Liefert die Position des Eintrags mit dem Schluessel key oder End().
+    //
+    uint Lookup(const Key& key) const;
+
+    //
+    //  Sortiert die count Eintraege ab data stabil nach Schluesseln. buffer
+    //  muss Platz fuer count Eintraege bieten und wird als Zwischenspeicher
+    //  verwendet.
+    //
+    static void MergeSort(Entry* data, Entry* buffer, uint count);
+
+    Array<Entry> m_entries;
+};
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+FlatMap<Key, T, Ownership>&
+FlatMap<Key, T, Ownership>::operator=(const FlatMap<Key, T, Ownership>& map)
+{
+    if (this != &map)
+    {
+        Clear();
+        m_entries = map.m_entries;
+
+        for (uint i = 0; i < m_entries.Count(); ++i)
+            m_entries[i].data = this->NewItem(m_entries[i].data);
+
+        this->AssignedFrom();
+    }
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+T* FlatMap<Key, T, Ownership>::Find(const Key& key) const
+{
+    uint pos = Lookup(key);
+    return pos != End() ? m_entries[pos].data : nullptr;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+uint FlatMap<Key, T, Ownership>::LowerBound(const Key& key) const
+{
+    const Entry* first = m_entries.Data();
+    const Entry* base = first;
+    uint count = m_entries.Count();
+
+    if (count == 0)
+        return 0;
+
+    //
+    //  Die Schleife halbiert den Suchbereich, ohne vom Ergebnis des
+    //  Vergleichs abhaengig zu verzweigen.
+    //
+    while (count > 1)
+    {
+        uint half = count / 2;
+        base = base[half].key < key ? base + half : base;
+        count -= half;
+    }
+
+    return (base - first) + (base->key < key);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+uint FlatMap<Key, T, Ownership>::UpperBound(const Key& key) const
+{
+    const Entry* first = m_entries.Data();
+    const Entry* base = first;
+    uint count = m_entries.Count();
+
+    if (count == 0)
+        return 0;
+
+    while (count > 1)
+    {
+        uint half = count / 2;
+        base = !(key < base[half].key) ? base + half : base;
+        count -= half;
+    }
+
+    return (base - first) + !(key < base->key);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+void FlatMap<Key, T, Ownership>::Clear()
+{
+    if (this->DeletesItems())
+    {
+        for (uint i = 0; i < m_entries.Count(); ++i)
+            this->DeleteItem(m_entries[i].data);
+    }
+
+    m_entries.Clear();
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+bool FlatMap<Key, T, Ownership>::Insert(const Key& key, T* data)
+{
+    uint pos = LowerBound(key);
+
+    if (pos != End() && !(key < m_entries[pos].key))
+        return false;
+
+    m_entries.Insert(Entry(key, this->NewItem(data)), pos);
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+void FlatMap<Key, T, Ownership>::Replace(const Key& key, T* data)
+{
+    uint pos = LowerBound(key);
+
+    if (pos != End() && !(key < m_entries[pos].key))
+    {
+        T* old_data = m_entries[pos].data;
+        m_entries[pos].data = this->NewItem(data);
+        this->DeleteItem(old_data);
+    }
+    else
+    {
+        m_entries.Insert(Entry(key, this->NewItem(data)), pos);
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+void FlatMap<Key, T, Ownership>::Assign(const Key* keys, T* const* data,
+                                        uint count)
+{
+    Clear();
+
+    if (count == 0)
+        return;
+
+    m_entries.Reserve(count);
+
+    for (uint i = 0; i < count; ++i)
+        m_entries.Emplace(keys[i], this->NewItem(data[i]));
+
+    Array<Entry> buffer(m_entries);
+    MergeSort(m_entries.Data(), buffer.Data(), count);
+
+    //
+    //  Gleiche Schluessel stehen nach dem stabilen Sortieren in der
+    //  Reihenfolge der Eingabe hintereinander; behalten wird jeweils der
+    //  letzte Eintrag.
+    //
+    uint last = 0;
+
+    for (uint i = 1; i < count; ++i)
+    {
+        Entry& entry = m_entries[i];
+
+        if (m_entries[last].key < entry.key)
+            ++last;
+        else
+            this->DeleteItem(m_entries[last].data);
+
+        if (last != i)
+            m_entries[last] = entry;
+    }
+
+    while (m_entries.Count() > last + 1)
+        m_entries.RemoveLast();
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+bool FlatMap<Key, T, Ownership>::Remove(const Key& key)
+{
+    uint pos = Lookup(key);
+
+    if (pos == End())
+        return false;
+
+    T* data = m_entries[pos].data;
+    m_entries.Remove(pos);
+    this->DeleteItem(data);
+
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+T* FlatMap<Key, T, Ownership>::Take(const Key& key)
+{
+    uint pos = Lookup(key);
+
+    if (pos == End())
+        return nullptr;
+
+    T* data = m_entries[pos].data;
+    m_entries.Remove(pos);
+
+    return data;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+template <class Fn>
+void FlatMap<Key, T, Ownership>::DoForEach(Fn fn) const
+{
+    for (uint i = 0; i < m_entries.Count(); ++i)
+        fn(m_entries[i].key, m_entries[i].data);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+uint FlatMap<Key, T, Ownership>::Lookup(const Key& key) const
+{
+    uint pos = LowerBound(key);
+
+    if (pos != End() && !(key < m_entries[pos].key))
+        return pos;
+
+    return End();
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Ownership>
+void FlatMap<Key, T, Ownership>::MergeSort(Entry* data, Entry* buffer,
+                                           uint count)
+{
+    //
+    //  Kurze Abschnitte werden durch Einfuegen sortiert.
+    //
+    if (count <= 16)
+    {
+        for (uint i = 1; i < count; ++i)
+        {
+            Entry entry = data[i];
+            uint j = i;
+
+            for (; j > 0 && entry.key < data[j - 1].key; --j)
+                data[j] = data[j - 1];
+
+            data[j] = entry;
+        }
+
+        return;
+    }
+
+    uint half = count / 2;
+
+    MergeSort(data, buffer, half);
+    MergeSort(data + half, buffer + half, count - half);
+
+    if (!(data[half].key < data[half - 1].key))
+        return;
+
+    for (uint i = 0; i < count; ++i)
+        buffer[i] = data[i];
+
+    uint left = 0;
+    uint right = half;
+
+    for (uint i = 0; i < count; ++i)
+    {
+        if (right == count
+            || (left < half && !(buffer[right].key < buffer[left].key)))
+        {
+            data[i] = buffer[left++];
+        }
+        else
+        {
+            data[i] = buffer[right++];
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+
+#endif
@@ -3,34 +3,146 @@
 
 #include "support/Utilities.h"
 
+#include <cstddef>
+#include <cstring>
+
 //----------------------------------------------------------------------------
 //
-//  Berechnet den FNA-1a-Hashwert des Speicherbereiches [p, p + size).
+//  Berechnet den 64-Bit-Hashwert des Speicherbereiches [p, p + size)
+//  (MurmurHash64A). Der Speicherbereich wird in 8-Byte-Worten verarbeitet;
+//  die Worte werden mit memcpy() gelesen und muessen daher nicht
+//  ausgerichtet sein.
+//
+//  Mit seed kann eine Familie verschiedener Hashfunktionen ausgewaehlt
+//  werden. Wird der Startwert zufaellig gewaehlt, koennen Angreifer keine
+//  Schluessel konstruieren, die gezielt auf denselben Hashwert fallen.
 //
-inline uint HashBuffer(const char* p, uint size)
+inline ulonglong HashBuffer64(const char* p, uint size, ulonglong seed = 0)
 {
-    uint h = 2166136261u;
+    const ulonglong m = 0xc6a4a7935bd1e995ull;
+    const int r = 47;
+
+    ulonglong h = seed ^ (size * m);
+    const char* end = p + (size & ~7u);
+
+    for (; p != end; p += 8)
+    {
+        ulonglong k;
+        memcpy(&k, p, sizeof(k));
+
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+
+        h ^= k;
+        h *= m;
+    }
+
+    //  Die restlichen Bytes werden absichtlich nacheinander eingemischt.
+
+    switch (size & 7)
+    {
+    case 7: h ^= ulonglong(uchar(p[6])) << 48;  // fall through
+    case 6: h ^= ulonglong(uchar(p[5])) << 40;  // fall through
+    case 5: h ^= ulonglong(uchar(p[4])) << 32;  // fall through
+    case 4: h ^= ulonglong(uchar(p[3])) << 24;  // fall through
+    case 3: h ^= ulonglong(uchar(p[2])) << 16;  // fall through
+    case 2: h ^= ulonglong(uchar(p[1])) << 8;   // fall through
+    case 1: h ^= ulonglong(uchar(p[0]));
+            h *= m;
+    }
 
-    for (int i = 0; i < size; ++i)
-        h = (h ^ *p++) * 16777619u;
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
 
     return h;
 }
 
 //----------------------------------------------------------------------------
 //
-//  Berechnet den FNA-1a-Hashwert der Null-terminierten Zeichenkette p.
+//  Faltet einen 64-Bit-Hashwert auf 32 Bit.
 //
-inline uint HashString(const char* p)
+inline uint HashFold(ulonglong h)
 {
-    uint h = 2166136261u;
+    return uint(h ^ (h >> 32));
+}
+
+//----------------------------------------------------------------------------
+//
+//  Berechnet den Hashwert des Speicherbereiches [p, p + size). Das Ergebnis
+//  ist nie 0, so dass 0 als "noch nicht berechnet" gespeichert werden kann
+//  (siehe StringBody::Hash()); ohne diese Abbildung haette z.B. die leere
+//  Zeichenkette den Hashwert 0.
+//
+inline uint HashBuffer(const char* p, uint size, ulonglong seed = 0)
+{
+    uint h = HashFold(HashBuffer64(p, size, seed));
+    return h != 0 ? h : 1;
+}
+
+//----------------------------------------------------------------------------
+//
+//  Berechnet den Hashwert der Null-terminierten Zeichenkette p. Das Ergebnis
+//  ist gleich HashBuffer(p, strlen(p), seed), so dass Strings, Zeichenketten
+//  und StringRefs mit denselben Zeichen denselben Hashwert haben. Die Laenge
+//  wird vorab mit strlen() bestimmt, das die Zeichenkette wortweise bzw. mit
+//  SIMD-Befehlen durchsucht.
+//
+inline uint HashString(const char* p, ulonglong seed = 0)
+{
+    return HashBuffer(p, strlen(p), seed);
+}
+
+//----------------------------------------------------------------------------
+//
+//  Durchmischt die Bits des Hashwertes h (Finalisierer von MurmurHash3).
+//  Danach haengt jedes Bit des Ergebnisses von allen Bits von h ab, so dass
+//  auch die unteren Bits als Index in eine Tabelle mit einer Zweierpotenz
+//  als Groesse taugen.
+//
+inline uint HashMix(uint h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    h ^= h >> 16;
+
+    return h;
+}
 
-    while (*p != '\0')
-        h = (h ^ *p++) * 16777619u;
+//----------------------------------------------------------------------------
+//
+//  Durchmischt die Bits des 64-Bit-Wertes h (Finalisierer von MurmurHash3).
+//
+inline ulonglong HashMix64(ulonglong h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
 
     return h;
 }
 
+//----------------------------------------------------------------------------
+//
+//  Berechnet den Hashwert eines Zeigers. Da Objekte ausgerichtet im Speicher
+//  liegen, sind die unteren Bits eines Zeigers fast immer 0; der Wert wird
+//  deshalb vollstaendig durchmischt.
+//
+inline uint HashPointer(const void* p)
+{
+    size_t value = reinterpret_cast<size_t>(p);
+
+    if (sizeof(value) > sizeof(uint))
+        return HashFold(HashMix64(value));
+
+    return HashMix(uint(value));
+}
+
 //----------------------------------------------------------------------------
 //
 //  Template fuer Hash-Funktionsobjekte.
@@ -42,6 +154,56 @@ struct DefaultHash
     { return HashBuffer(reinterpret_cast<const char*>(&key), sizeof(T)); }
 };
 
+//----------------------------------------------------------------------------
+//
+//  Liefert in VALUE true, wenn das Hash-Funktionsobjekt Hash transparent ist
+//  und Schluessel vom Typ K annimmt. Ein transparentes Hash-Objekt berechnet
+//  fuer verwandte Schluesseltypen (etwa String, const char* und StringRef)
+//  gleicher Zeichen denselben Hashwert, so dass Dict und HashTable mit
+//  diesen Typen suchen koennen, ohne ein temporaeres Key-Objekt anzulegen.
+//
+//  Ein transparentes Hash-Objekt definiert den Typ Hash::Transparent, in
+//  den sich alle zulaessigen Schluesseltypen implizit umwandeln lassen
+//  muessen, z.B. StringRef. Andere Typen wie int werden von den
+//  transparenten Funktionen von Dict und HashTable per EnableIf
+//  ausgeschlossen, statt erst in deren Implementierung einen Fehler
+//  auszuloesen.
+//
+template <bool transparent, class Hash, class K>
+struct IsTransparentKey
+{
+    enum { VALUE = false };
+};
+
+template <class Hash, class K>
+struct IsTransparentKey<true, Hash, K>
+{
+    typedef char    Yes;
+    typedef char    No[2];
+
+    static Yes& Test(typename Hash::Transparent);
+    static No& Test(...);
+    static const K& Key();
+
+    enum { VALUE = sizeof(Test(Key())) == sizeof(Yes) };
+};
+
+template <class Hash, class K>
+struct IsTransparentHash
+{
+    typedef char    Yes;
+    typedef char    No[2];
+
+    template <class U> static Yes& Test(typename U::Transparent*);
+    template <class U> static No& Test(...);
+
+    enum
+    {
+        VALUE = IsTransparentKey<
+            sizeof(Test<Hash>(nullptr)) == sizeof(Yes), Hash, K>::VALUE
+    };
+};
+
 //----------------------------------------------------------------------------
 //
 //  Partielle Hash-Spezialisierung fuer Zeigertypen.
@@ -50,7 +212,7 @@ template <class T>
 struct DefaultHash<T*>
 {
     uint operator()(T* key) const
-    { return reinterpret_cast<uint>(key); }
+    { return HashPointer(key); }
 };
 
 //----------------------------------------------------------------------------
@@ -72,7 +234,7 @@ template <>
 struct DefaultHash<uint>
 {
     uint operator()(uint key) const
-    { return key; }
+    { return HashMix(key); }
 };
 
 //----------------------------------------------------------------------------
@@ -0,0 +1,621 @@
+#ifndef support_HashTable_h
+#define support_HashTable_h
+
+#include "support/Collection.h"
+#include "support/Hash.h"
+#include "support/Utilities.h"
+
+#include <new>
+
+//----------------------------------------------------------------------------
+//
+//  Template-Klasse, die eine Hashtabelle mit offener Adressierung
+//  bereitstellt.
+//
+//  Im Gegensatz zu Dict, das fuer jeden Eintrag einen eigenen Knoten anlegt
+//  und Kollisionen ueber verkettete Listen aufloest, liegen die Eintraege
+//  einer HashTable direkt in einem Array. Kollisionen werden durch lineares
+//  Sondieren nach dem Robin-Hood-Verfahren aufgeloest: Beim Einfuegen
+//  verdraengt ein Eintrag, der schon weiter von seiner Ausgangsposition
+//  entfernt ist, einen Eintrag, der naeher an seiner eigenen liegt. Dadurch
+//  bleiben die Sondierungsfolgen kurz und gleichmaessig lang, und eine
+//  erfolglose Suche kann abgebrochen werden, sobald sie auf einen Eintrag
+//  mit kuerzerer Distanz trifft. Beim Entfernen werden die nachfolgenden
+//  Eintraege zurueckgeschoben, so dass keine Grabsteine noetig sind.
+//
+//  Die Groesse der Tabelle ist immer eine Zweierpotenz. Der Hashwert wird
+//  mit HashMix() durchmischt, bevor seine unteren Bits als Index verwendet
+//  werden. Die Tabelle waechst automatisch auf die doppelte Groesse, wenn
+//  sie zu 7/8 gefuellt ist oder eine Sondierungsfolge laenger als
+//  MAX_PROBE wird.
+//
+//  Jeder Schluessel kann nur einmal in der Tabelle vorkommen. Key muss
+//  kopierbar sein und den Operator "==" bereitstellen.
+//
+//  Wie Dict speichert eine HashTable nur Zeiger auf die Elemente. Das
+//  Kopieren und Loeschen der Elemente wird wie bei allen Collections ueber
+//  AutoDelete bzw. den Parameter Ownership (siehe Collection.h) gesteuert.
+//
+template <class Key, class T, class Hash = DefaultHash<Key>,
+          class Ownership = DynamicOwnership<T> >
+class HashTable: public Collection<T, Ownership>
+{
+public:
+
+    static const uint   MIN_SIZE    = 8;
+    static const uint   MAX_PROBE   = 32;
+
+    //
+    //  Erstellt eine leere Hashtabelle. Die Groesse wird auf die naechste
+    //  Zweierpotenz, mindestens aber MIN_SIZE aufgerundet.
+    //
+    HashTable(uint size = MIN_SIZE);
+
+    //
+    //  Entfernt alle Elemente aus der Tabelle und zerstoert das Objekt.
+    //  Wenn AutoDelete auf true gesetzt ist, werden auch die Elemente
+    //  geloescht.
+    //
+    virtual ~HashTable();
+
+    //
+    //  Liefert die Groesse der Hashtabelle.
+    //
+    uint Size() const
+    { return m_size; }
+
+    //
+    //  Liefert die Anzahl der in der Hashtabelle gespeicherten Elemente.
+    //
+    uint Count() const
+    { return m_count; }
+
+    //
+    //  Weist dem Objekt eine Kopie der Tabelle table zu. Dabei werden nur
+    //  die Zeiger auf die Elemente kopiert. Ist die Tabelle vorher nicht
+    //  leer, werden alle Elemente entfernt und - falls AutoDelete auf true
+    //  gesetzt ist - geloescht. Danach wird AutoDelete auf false gesetzt.
+    //
+    HashTable<Key, T, Hash, Ownership>& operator=(
+        const HashTable<Key, T, Hash, Ownership>& table);
+
+    //
+    //  Liefert einen Zeiger auf das Element mit dem Schluessel key oder 0,
+    //  wenn kein solches Element existiert. Dieser Operator entspricht der
+    //  Funktion Find().
+    //
+    T* operator[](const Key& key) const
+    { return Find(key); }
+
+    //
+    //  Entfernt alle Elemente aus der Tabelle. Ist AutoDelete auf true
+    //  gesetzt, werden die Elemente danach mit delete geloescht. Die Groesse
+    //  der Tabelle bleibt erhalten.
+    //
+    void Clear();
+
+    //
+    //  Fuegt das Element data unter dem Schluessel key in die Tabelle ein
+    //  und liefert true. Existiert bereits ein Element mit diesem Schluessel,
+    //  wird die Tabelle nicht veraendert und die Funktion liefert false.
+    //
+    bool Insert(const Key& key, T* data);
+
+    //
+    //  Ersetzt das Element mit dem Schluessel key durch data. Ist AutoDelete
+    //  auf true gesetzt, wird das alte Element geloescht. Wenn kein Element
+    //  unter diesem Schluessel existiert, wird data neu eingefuegt.
+    //
+    void Replace(const Key& key, T* data);
+
+    //
+    //  Entfernt das Element mit dem Schluessel key. Ist AutoDelete auf true
+    //  gesetzt, wird das Element geloescht. Die Funktion liefert true, wenn
+    //  das Element entfernt wurde, und false, wenn kein Element unter diesem
+    //  Schluessel existiert.
+    //
+    bool Remove(const Key& key)
+    { return _Remove(key); }
+
+    //
+    //  Entfernt das Element mit dem Schluessel key aus der Tabelle ohne es
+    //  zu loeschen, auch wenn AutoDelete auf true gesetzt ist. Die Funktion
+    //  liefert einen Zeiger auf das entfernte Element, oder 0, wenn kein
+    //  solches Element gefunden wird.
+    //
+    T* Take(const Key& key)
+    { return _Take(key); }
+
+    //
+    //  Liefert einen Zeiger auf das Element mit dem Schluessel key, oder 0,
+    //  wenn kein solches Element existiert.
+    //
+    T* Find(const Key& key) const
+    { return _Find(key); }
+
+    //
+    //  Varianten von Remove(), Take() und Find() fuer Schluessel eines
+    //  anderen Typs K (siehe die entsprechenden Funktionen von Dict). Sie
+    //  stehen nur zur Verfuegung, wenn Hash transparent ist.
+    //
+    template <class K>
+    typename EnableIf<IsTransparentHash<Hash, K>::VALUE, bool>::Type
+    Remove(const K& key)
+    { return _Remove(key); }
+
+    template <class K>
+    typename EnableIf<IsTransparentHash<Hash, K>::VALUE, T*>::Type
+    Take(const K& key)
+    { return _Take(key); }
+
+    template <class K>
+    typename EnableIf<IsTransparentHash<Hash, K>::VALUE, T*>::Type
+    Find(const K& key) const
+    { return _Find(key); }
+
+    //
+    //  Vergroessert die Tabelle so, dass sie count Elemente aufnehmen kann,
+    //  ohne waehrend des Einfuegens wachsen zu muessen.
+    //
+    void Reserve(uint count);
+
+    //
+    //  Ruft fuer jedes Element der Tabelle die Funktion fn auf. Dies muss
+    //  eine Funktion mit zwei Parametern der Typen Key und T* oder ein
+    //  entsprechendes Funktionsobjekt sein. Die Reihenfolge ist nicht
+    //  festgelegt.
+    //
+    template <class Fn> void DoForEach(Fn fn) const;
+
+private:
+
+    //
+    //  Collections koennen nicht kopiert werden, weil ein ueberschriebenes
+    //  NewItem() nicht von einem Konstruktor aus aufgerufen werden kann.
+    //
+    HashTable(const HashTable<Key, T, Hash, Ownership>&);
+
+    //
+    //  Verwaltungsdaten eines Eintrags. distance ist der Abstand zur
+    //  Ausgangsposition plus 1; ein Wert von 0 kennzeichnet einen leeren
+    //  Eintrag. Der Schluessel liegt an derselben Position in m_keys.
+    //
+    struct Slot
+    {
+        uint    hash;
+        uint    distance;
+        T*      data;
+    };
+
+    //
+    //  Berechnet den durchmischten Hashwert des Schluessels key.
+    //
+    template <class K>
+    uint HashOf(const K& key) const
+    { return HashMix(m_hasher(key)); }
+
+    //
+    //  Liefert die Position des Eintrags mit dem Schluessel key oder
+    //  m_size, wenn kein solcher Eintrag existiert.
+    //
+    template <class K> uint Lookup(const K& key, uint hash) const;
+
+    //
+    //  Implementierung von Remove(), Take() und Find() fuer Schluessel vom
+    //  Typ Key oder, bei transparentem Hash, eines verwandten Typs.
+    //
+    template <class K> bool _Remove(const K& key);
+    template <class K> T* _Take(const K& key);
+    template <class K> T* _Find(const K& key) const;
+
+    //
+    //  Fuegt einen Eintrag ein, dessen Schluessel noch nicht in der Tabelle
+    //  enthalten ist. Wird die Sondierungsfolge zu lang, waechst die Tabelle.
+    //
+    void _Insert(uint hash, const Key& key, T* data);
+
+    //
+    //  Entfernt den Eintrag an der Position index und schiebt die
+    //  nachfolgenden Eintraege der Sondierungsfolge zurueck.
+    //
+    void _Erase(uint index);
+
+    //
+    //  Baut die Tabelle mit der Groesse size neu auf.
+    //
+    void Rehash(uint size);
+
+    //
+    //  Reserviert leere Arrays der Groesse size.
+    //
+    void _Allocate(uint size);
+
+    //
+    //  Zerstoert alle Schluessel und gibt die Arrays frei, ohne die
+    //  Elemente zu loeschen.
+    //
+    void _Free();
+
+    //
+    //  Erstellt die Tabelle als Kopie von table. Diese Funktion gibt die
+    //  bisherigen Arrays nicht frei!
+    //
+    void _Copy(const HashTable<Key, T, Hash, Ownership>& table);
+
+    uint    m_size;
+    uint    m_count;
+    uint    m_maxCount;
+    Slot*   m_slots;
+    Key*    m_keys;
+    Hash    m_hasher;
+};
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+HashTable<Key, T, Hash, Ownership>::HashTable(uint size)
+{
+    uint new_size = MIN_SIZE;
+
+    while (new_size < size)
+        new_size *= 2;
+
+    _Allocate(new_size);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+HashTable<Key, T, Hash, Ownership>::~HashTable()
+{
+    Clear();
+    _Free();
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+HashTable<Key, T, Hash, Ownership>&
+HashTable<Key, T, Hash, Ownership>::operator=(
+    const HashTable<Key, T, Hash, Ownership>& table)
+{
+    if (this != &table)
+    {
+        Clear();
+        _Free();
+
+        _Copy(table);
+        this->AssignedFrom();
+    }
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void HashTable<Key, T, Hash, Ownership>::Clear()
+{
+    for (uint i = 0; i < m_size; ++i)
+    {
+        Slot& slot = m_slots[i];
+
+        if (slot.distance == 0)
+            continue;
+
+        m_keys[i].~Key();
+        slot.distance = 0;
+
+        if (this->DeletesItems())
+            this->DeleteItem(slot.data);
+    }
+
+    m_count = 0;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+bool HashTable<Key, T, Hash, Ownership>::Insert(const Key& key, T* data)
+{
+    uint hash = HashOf(key);
+
+    if (Lookup(key, hash) != m_size)
+        return false;
+
+    if (m_count >= m_maxCount)
+        Rehash(m_size * 2);
+
+    _Insert(hash, key, this->NewItem(data));
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void HashTable<Key, T, Hash, Ownership>::Replace(const Key& key, T* data)
+{
+    uint hash = HashOf(key);
+    uint index = Lookup(key, hash);
+
+    if (index == m_size)
+    {
+        if (m_count >= m_maxCount)
+            Rehash(m_size * 2);
+
+        _Insert(hash, key, this->NewItem(data));
+        return;
+    }
+
+    T* old_data = m_slots[index].data;
+    m_slots[index].data = this->NewItem(data);
+    this->DeleteItem(old_data);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+template <class K>
+bool HashTable<Key, T, Hash, Ownership>::_Remove(const K& key)
+{
+    uint index = Lookup(key, HashOf(key));
+
+    if (index == m_size)
+        return false;
+
+    T* data = m_slots[index].data;
+    _Erase(index);
+
+    this->DeleteItem(data);
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+template <class K>
+T* HashTable<Key, T, Hash, Ownership>::_Take(const K& key)
+{
+    uint index = Lookup(key, HashOf(key));
+
+    if (index == m_size)
+        return nullptr;
+
+    T* data = m_slots[index].data;
+    _Erase(index);
+
+    return data;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+template <class K>
+T* HashTable<Key, T, Hash, Ownership>::_Find(const K& key) const
+{
+    uint index = Lookup(key, HashOf(key));
+    return index != m_size ? m_slots[index].data : nullptr;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void HashTable<Key, T, Hash, Ownership>::Reserve(uint count)
+{
+    uint size = m_size;
+
+    while (size - size / 8 < count)
+        size *= 2;
+
+    if (size != m_size)
+        Rehash(size);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+template <class Fn>
+void HashTable<Key, T, Hash, Ownership>::DoForEach(Fn fn) const
+{
+    for (uint i = 0; i < m_size; ++i)
+    {
+        if (m_slots[i].distance != 0)
+            fn(m_keys[i], m_slots[i].data);
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+template <class K>
+uint HashTable<Key, T, Hash, Ownership>::Lookup(const K& key, uint hash) const
+{
+    uint mask = m_size - 1;
+    uint index = hash & mask;
+
+    for (uint distance = 1; ; ++distance)
+    {
+        const Slot& slot = m_slots[index];
+
+        //
+        //  Ein leerer Eintrag oder ein Eintrag, der naeher an seiner
+        //  Ausgangsposition liegt, beendet die Suche: Der gesuchte Schluessel
+        //  haette ihn beim Einfuegen verdraengt.
+        //
+        if (slot.distance < distance)
+            return m_size;
+
+        if (slot.hash == hash && m_keys[index] == key)
+            return index;
+
+        index = (index + 1) & mask;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void HashTable<Key, T, Hash, Ownership>::_Insert(
+    uint hash, const Key& key, T* data)
+{
+    Key cur_key(key);
+    uint cur_hash = hash;
+    T* cur_data = data;
+    uint distance = 1;
+
+    uint mask = m_size - 1;
+    uint index = hash & mask;
+
+    for (;;)
+    {
+        Slot& slot = m_slots[index];
+
+        if (slot.distance == 0)
+        {
+            slot.hash = cur_hash;
+            slot.distance = distance;
+            slot.data = cur_data;
+            new (&m_keys[index]) Key(cur_key);
+
+            ++m_count;
+            return;
+        }
+
+        if (slot.distance < distance)
+        {
+            Swap(slot.hash, cur_hash);
+            Swap(slot.distance, distance);
+            Swap(slot.data, cur_data);
+            Swap(m_keys[index], cur_key);
+        }
+
+        ++distance;
+
+        //
+        //  Die Sondierungsfolge ist zu lang geworden. Der gerade verdraengte
+        //  Eintrag wird nach dem Vergroessern neu eingefuegt. Ist die Tabelle
+        //  schon sehr duenn besetzt, liegt das an einer schlechten
+        //  Hashfunktion, und weiteres Wachstum wuerde nichts nuetzen.
+        //
+        if (distance > MAX_PROBE && m_count >= m_size / 4)
+        {
+            Rehash(m_size * 2);
+            _Insert(cur_hash, cur_key, cur_data);
+            return;
+        }
+
+        index = (index + 1) & mask;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void HashTable<Key, T, Hash, Ownership>::_Erase(uint index)
+{
+    uint mask = m_size - 1;
+    uint next = (index + 1) & mask;
+
+    m_keys[index].~Key();
+
+    while (m_slots[next].distance > 1)
+    {
+        m_slots[index] = m_slots[next];
+        --m_slots[index].distance;
+
+        new (&m_keys[index]) Key(m_keys[next]);
+        m_keys[next].~Key();
+
+        index = next;
+        next = (next + 1) & mask;
+    }
+
+    m_slots[index].distance = 0;
+    --m_count;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void HashTable<Key, T, Hash, Ownership>::Rehash(uint size)
+{
+    uint old_size = m_size;
+    Slot* old_slots = m_slots;
+    Key* old_keys = m_keys;
+
+    _Allocate(size);
+
+    //
+    //  _Insert() arbeitet immer auf den aktuellen Arrays. Waechst die
+    //  Tabelle waehrend des Umkopierens erneut, landen die restlichen
+    //  Eintraege daher automatisch in der neuen Tabelle.
+    //
+    for (uint i = 0; i < old_size; ++i)
+    {
+        if (old_slots[i].distance == 0)
+            continue;
+
+        _Insert(old_slots[i].hash, old_keys[i], old_slots[i].data);
+        old_keys[i].~Key();
+    }
+
+    delete[] old_slots;
+    ::operator delete(old_keys);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void HashTable<Key, T, Hash, Ownership>::_Allocate(uint size)
+{
+    m_size = size;
+    m_count = 0;
+    m_maxCount = size - size / 8;
+    m_slots = new Slot[size];
+    m_keys = static_cast<Key*>(::operator new(size * sizeof(Key)));
+
+    for (uint i = 0; i < size; ++i)
+        m_slots[i].distance = 0;
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void HashTable<Key, T, Hash, Ownership>::_Free()
+{
+    for (uint i = 0; i < m_size; ++i)
+    {
+        if (m_slots[i].distance != 0)
+            m_keys[i].~Key();
+    }
+
+    delete[] m_slots;
+    ::operator delete(m_keys);
+}
+
+//----------------------------------------------------------------------------
+
+template <class Key, class T, class Hash, class Ownership>
+void HashTable<Key, T, Hash, Ownership>::_Copy(
+    const HashTable<Key, T, Hash, Ownership>& table)
+{
+    _Allocate(table.m_size);
+
+    for (uint i = 0; i < m_size; ++i)
+    {
+        const Slot& src_slot = table.m_slots[i];
+
+        if (src_slot.distance == 0)
+            continue;
+
+        m_slots[i] = src_slot;
+        m_slots[i].data = this->NewItem(src_slot.data);
+        new (&m_keys[i]) Key(table.m_keys[i]);
+    }
+
+    m_count = table.m_count;
+}
+
+//----------------------------------------------------------------------------
+
+#endif
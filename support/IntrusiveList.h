@@ -0,0 +1,248 @@
+#ifndef support_IntrusiveList_h
+#define support_IntrusiveList_h
+
+#include "support/Utilities.h"
+
+//----------------------------------------------------------------------------
+//
+//  Verkettungsfeld fuer Objekte, die in einer IntrusiveList stehen sollen.
+//
+//  Der Hook wird als Datenelement in die Klasse T aufgenommen. Er enthaelt
+//  die Zeiger auf den Vorgaenger und den Nachfolger sowie die Liste, in der
+//  das Objekt gerade steht. Beim Kopieren eines Objekts wird der Hook nicht
+//  mitkopiert; die Kopie steht in keiner Liste.
+//
+template <class T>
+struct IntrusiveListHook
+{
+    IntrusiveListHook()
+        : next(nullptr), prev(nullptr), owner(nullptr) {}
+
+    IntrusiveListHook(const IntrusiveListHook<T>&)
+        : next(nullptr), prev(nullptr), owner(nullptr) {}
+
+    IntrusiveListHook<T>& operator=(const IntrusiveListHook<T>&)
+    { return *this; }
+
+    //
+    //  Liefert true, wenn das Objekt in einer Liste steht.
+    //
+    bool IsLinked() const
+    { return owner != nullptr; }
+
+    T*          next;
+    T*          prev;
+    const void* owner;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Template-Klasse fuer eine doppelt verkettete Liste, deren
+//  Verkettungsfelder in den Elementen selbst liegen.
+//
+//  Im Gegensatz zu List legt eine IntrusiveList keine eigenen Knoten an.
+//  Die Verkettung steht in dem Datenelement Hook vom Typ
+//  IntrusiveListHook<T> der Elemente, so dass Einfuegen und Entfernen ohne
+//  Speicheranforderung und - da jedes Element seine Nachbarn kennt - in
+//  konstanter Zeit erfolgen. Ein Element kann zu einem Zeitpunkt in
+//  hoechstens einer Liste pro Hook stehen.
+//
+//  Die Liste besitzt ihre Elemente nicht: Sie werden weder kopiert noch
+//  geloescht. Ein Element muss aus der Liste entfernt werden, bevor es
+//  zerstoert wird.
+//
+template <class T, IntrusiveListHook<T> T::*Hook>
+class IntrusiveList
+{
+public:
+
+    //
+    //  Erstellt eine leere Liste.
+    //
+    IntrusiveList()
+        : m_count(0), m_first(nullptr), m_last(nullptr) {}
+
+    //
+    //  Entfernt alle Elemente aus der Liste und zerstoert das Objekt.
+    //
+    ~IntrusiveList()
+    { Clear(); }
+
+    //
+    //  Liefert die Anzahl der Elemente der Liste.
+    //
+    uint Count() const
+    { return m_count; }
+
+    //
+    //  Liefert true, wenn die Liste leer ist.
+    //
+    bool IsEmpty() const
+    { return m_count == 0; }
+
+    //
+    //  Liefern das erste bzw. letzte Element oder 0, wenn die Liste leer
+    //  ist.
+    //
+    T* First() const
+    { return m_first; }
+
+    T* Last() const
+    { return m_last; }
+
+    //
+    //  Liefern den Nachfolger bzw. Vorgaenger von item oder 0, wenn item
+    //  das letzte bzw. erste Element ist.
+    //
+    static T* Next(const T* item)
+    { return (item->*Hook).next; }
+
+    static T* Prev(const T* item)
+    { return (item->*Hook).prev; }
+
+    //
+    //  Liefert true, wenn item in dieser Liste steht. Die Funktion benoetigt
+    //  konstante Zeit.
+    //
+    bool Contains(const T* item) const
+    { return (item->*Hook).owner == this; }
+
+    //
+    //  Fuegt item am Ende bzw. am Anfang der Liste ein. item darf in keiner
+    //  anderen Liste mit demselben Hook stehen.
+    //
+    void Append(T* item)
+    { Insert(item, nullptr); }
+
+    void Prepend(T* item)
+    { Insert(item, m_first); }
+
+    //
+    //  Fuegt item vor dem Element pos ein. Ist pos gleich 0, wird item am
+    //  Ende der Liste eingefuegt.
+    //
+    void Insert(T* item, T* pos);
+
+    //
+    //  Entfernt item aus der Liste. Die Funktion liefert false, wenn item
+    //  nicht in dieser Liste steht, sonst true.
+    //
+    bool Remove(T* item);
+
+    //
+    //  Entfernt alle Elemente aus der Liste.
+    //
+    void Clear();
+
+    //
+    //  Ruft fuer jedes Element der Liste die Funktion fn auf. Dies muss eine
+    //  Funktion mit einem Parameter vom Typ T* oder ein entsprechendes
+    //  Funktionsobjekt sein. fn darf das aktuelle Element aus der Liste
+    //  entfernen.
+    //
+    template <class Fn> void DoForEach(Fn fn) const;
+
+private:
+
+    IntrusiveList(const IntrusiveList<T, Hook>&);
+    IntrusiveList<T, Hook>& operator=(const IntrusiveList<T, Hook>&);
+
+    uint    m_count;
+    T*      m_first;
+    T*      m_last;
+};
+
+//----------------------------------------------------------------------------
+
+template <class T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::Insert(T* item, T* pos)
+{
+    IntrusiveListHook<T>& hook = item->*Hook;
+    T* prev = pos != nullptr ? (pos->*Hook).prev : m_last;
+
+    hook.next = pos;
+    hook.prev = prev;
+    hook.owner = this;
+
+    if (prev != nullptr)
+        (prev->*Hook).next = item;
+    else
+        m_first = item;
+
+    if (pos != nullptr)
+        (pos->*Hook).prev = item;
+    else
+        m_last = item;
+
+    ++m_count;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, IntrusiveListHook<T> T::*Hook>
+bool IntrusiveList<T, Hook>::Remove(T* item)
+{
+    IntrusiveListHook<T>& hook = item->*Hook;
+
+    if (hook.owner != this)
+        return false;
+
+    if (hook.prev != nullptr)
+        (hook.prev->*Hook).next = hook.next;
+    else
+        m_first = hook.next;
+
+    if (hook.next != nullptr)
+        (hook.next->*Hook).prev = hook.prev;
+    else
+        m_last = hook.prev;
+
+    hook.next = nullptr;
+    hook.prev = nullptr;
+    hook.owner = nullptr;
+
+    --m_count;
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, IntrusiveListHook<T> T::*Hook>
+void IntrusiveList<T, Hook>::Clear()
+{
+    T* item = m_first;
+
+    while (item != nullptr)
+    {
+        IntrusiveListHook<T>& hook = item->*Hook;
+        item = hook.next;
+
+        hook.next = nullptr;
+        hook.prev = nullptr;
+        hook.owner = nullptr;
+    }
+
+    m_count = 0;
+    m_first = nullptr;
+    m_last = nullptr;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, IntrusiveListHook<T> T::*Hook>
+template <class Fn>
+void IntrusiveList<T, Hook>::DoForEach(Fn fn) const
+{
+    T* item = m_first;
+
+    while (item != nullptr)
+    {
+        T* next = (item->*Hook).next;
+        fn(item);
+        item = next;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+#endif
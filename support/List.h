@@ -2,6 +2,7 @@
 #define support_List_h
 
 #include "support/Collection.h"
+#include "support/NodePool.h"
 #include "support/Utilities.h"
 
 template <class T>
@@ -10,6 +11,32 @@ class ListIterator;
 template <class T>
 class ListConstIterator;
 
+//----------------------------------------------------------------------------
+//
+//  Verkettungselemente der List-Klasse. Sie haengen nicht von der
+//  Ownership-Strategie der Liste ab, so dass alle Listen mit gleichem
+//  Elementtyp dieselben Iteratoren verwenden.
+//
+struct ListLink
+{
+    ListLink() {}
+    ListLink(ListLink* next, ListLink* prev)
+        : next(next), prev(prev) {}
+
+    ListLink* next;
+    ListLink* prev;
+};
+
+template <class T>
+struct ListNode: public ListLink
+{
+    ListNode(T* data): data(data) {}
+    ListNode(T* data, ListLink* next, ListLink* prev)
+        : ListLink(next, prev), data(data) {}
+
+    T* data;
+};
+
 //----------------------------------------------------------------------------
 //
 //  Template-Klasse, die eine doppelt verkettete Liste bereitstellt.
@@ -24,8 +51,11 @@ class ListConstIterator;
 //  Option auf true gesetzt werden. Die Standardvorgabe ist false, d.h. die
 //  Elemente werden nicht geloescht.
 //
-template <class T>
-class List: public Collection<T>
+//  Alternativ kann ueber den Parameter Ownership eine statische Strategie
+//  (siehe Collection.h) gewaehlt werden.
+//
+template <class T, class Ownership = DynamicOwnership<T> >
+class List: public Collection<T, Ownership>
 {
 public:
 
@@ -52,13 +82,13 @@ public:
     //  werden alle Elemente entfernt und - falls AutoDelete auf true gesetzt
     //  ist - geloescht.
     //
-    List& operator=(const List<T>& list);
+    List& operator=(const List<T, Ownership>& list);
 
     //
     //  Kopiert die Liste list an das Ende der Liste. Dabei werden nur die
     //  Zeiger auf die Elemente kopiert.
     //
-    List& operator+=(const List<T>& list)
+    List& operator+=(const List<T, Ownership>& list)
     { Append(list); return *this; }
 
     //
@@ -174,14 +204,14 @@ public:
     //  Haengt data an das Ende der Liste an. Es wird nur der Zeiger auf data
     //  kopiert, solange NewItem() nicht ueberschrieben wird.
     //
-    List<T>& Append(T* data)
+    List<T, Ownership>& Append(T* data)
     { Insert(data, End()); return *this; }
 
     //
     //  Kopiert die Liste list an das Ende der Liste. Dabei werden nur die
     //  Zeiger auf die Elemente kopiert.
     //
-    List<T>& Append(const List<T>& list);
+    List<T, Ownership>& Append(const List<T, Ownership>& list);
 
     //
     //  Entfernt das Element an der Position pos aus der Liste. Ist AutoDelete
@@ -238,29 +268,13 @@ private:
     //  Collections koennen nicht kopiert werden, weil ein ueberschriebenes
     //  NewItem() nicht von einem Konstruktor aus aufgerufen werden kann.
     //
-    List(const List<T>&);
+    List(const List<T, Ownership>&);
 
     friend class ListIterator<T>;
     friend class ListConstIterator<T>;
 
-    struct Link
-    {
-        Link() {}
-        Link(Link* next, Link* prev)
-            : next(next), prev(prev) {}
-
-        Link* next;
-        Link* prev;
-    };
-
-    struct Node: public Link
-    {
-        Node(T* data): data(data) {}
-        Node(T* data, Link* next, Link* prev)
-            : Link(next, prev), data(data) {}
-
-        T* data;
-    };
+    typedef ListLink    Link;
+    typedef ListNode<T> Node;
 
     inline void LinkNodes(Link* prev, Link* next)
     {
@@ -271,8 +285,9 @@ private:
     inline void UnlinkNode(Link* node)
     { LinkNodes(node->prev, node->next); }
 
-    uint    m_count;
-    Link    m_end;
+    uint            m_count;
+    Link            m_end;
+    NodePool<Node>  m_pool;
 };
 
 //----------------------------------------------------------------------------
@@ -290,8 +305,8 @@ bool operator!=(const ListIterator<T>&, const ListConstIterator<T>&);
 template <class T>
 class ListIterator
 {
-    typedef typename List<T>::Link      Link;
-    typedef typename List<T>::Node      Node;
+    typedef ListLink        Link;
+    typedef ListNode<T>     Node;
 
 public:
 
@@ -351,7 +366,7 @@ public:
 
 private:
 
-    friend class List<T>;
+    template <class U, class Ownership> friend class List;
     friend class ListConstIterator<T>;
 
     friend bool ::operator==<>(const ListIterator<T>&,
@@ -372,8 +387,8 @@ private:
 template <class T>
 class ListConstIterator
 {
-    typedef const typename List<T>::Link    Link;
-    typedef const typename List<T>::Node    Node;
+    typedef const ListLink      Link;
+    typedef const ListNode<T>   Node;
 
 public:
 
@@ -444,7 +459,7 @@ public:
 
 private:
 
-    friend class List<T>;
+    template <class U, class Ownership> friend class List;
 
     friend bool ::operator==<>(const ListIterator<T>&,
                                const ListConstIterator<T>&);
@@ -471,14 +486,15 @@ inline bool operator!=(const ListIterator<T>& lhs,
 
 //----------------------------------------------------------------------------
 
-template <class T>
-List<T>& List<T>::operator=(const List<T>& list)
+template <class T, class Ownership>
+List<T, Ownership>&
+List<T, Ownership>::operator=(const List<T, Ownership>& list)
 {
     if (this != &list)
     {
         Clear();
         Append(list);
-        this->SetAutoDelete(false);
+        this->AssignedFrom();
     }
 
     return *this;
@@ -486,9 +502,9 @@ List<T>& List<T>::operator=(const List<T>& list)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-typename List<T>::Iterator
-List<T>::FindNext(const T& data, const Iterator& pos)
+template <class T, class Ownership>
+typename List<T, Ownership>::Iterator
+List<T, Ownership>::FindNext(const T& data, const Iterator& pos)
 {
     ConstIterator end = End();
     Iterator p = pos;
@@ -504,9 +520,9 @@ List<T>::FindNext(const T& data, const Iterator& pos)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-typename List<T>::ConstIterator
-List<T>::FindNext(const T& data, const ConstIterator& pos) const
+template <class T, class Ownership>
+typename List<T, Ownership>::ConstIterator
+List<T, Ownership>::FindNext(const T& data, const ConstIterator& pos) const
 {
     ConstIterator end = End();
     ConstIterator p = pos;
@@ -522,9 +538,9 @@ List<T>::FindNext(const T& data, const ConstIterator& pos) const
 
 //----------------------------------------------------------------------------
 
-template <class T>
-typename List<T>::Iterator
-List<T>::FindNextRef(const T* data, const Iterator& pos)
+template <class T, class Ownership>
+typename List<T, Ownership>::Iterator
+List<T, Ownership>::FindNextRef(const T* data, const Iterator& pos)
 {
     ConstIterator end = End();
     Iterator p = pos;
@@ -540,9 +556,9 @@ List<T>::FindNextRef(const T* data, const Iterator& pos)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-typename List<T>::ConstIterator
-List<T>::FindNextRef(const T* data, const ConstIterator& pos) const
+template <class T, class Ownership>
+typename List<T, Ownership>::ConstIterator
+List<T, Ownership>::FindNextRef(const T* data, const ConstIterator& pos) const
 {
     ConstIterator end = End();
     ConstIterator p = pos;
@@ -558,27 +574,31 @@ List<T>::FindNextRef(const T* data, const ConstIterator& pos) const
 
 //----------------------------------------------------------------------------
 
-template <class T>
-void List<T>::Clear()
+template <class T, class Ownership>
+void List<T, Ownership>::Clear()
 {
     while (m_end.next != &m_end)
     {
         Node* node = static_cast<Node*>(m_end.next);
         m_end.next = node->next;
-        this->DeleteItem(node->data);
-        delete node;
+
+        if (this->DeletesItems())
+            this->DeleteItem(node->data);
+
+        m_pool.Free(node);
     }
 
     m_end.prev = &m_end;
     m_count = 0;
+    m_pool.Clear();
 }
 
 //----------------------------------------------------------------------------
 
-template <class T>
-void List<T>::Insert(T* data, const Iterator& pos)
+template <class T, class Ownership>
+void List<T, Ownership>::Insert(T* data, const Iterator& pos)
 {
-    Node* new_node = new Node(this->NewItem(data));
+    Node* new_node = new (m_pool.Allocate()) Node(this->NewItem(data));
     LinkNodes(pos.m_node->prev, new_node);
     LinkNodes(new_node, pos.m_node);
     ++m_count;
@@ -586,9 +606,12 @@ void List<T>::Insert(T* data, const Iterator& pos)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-List<T>& List<T>::Append(const List<T>& list)
+template <class T, class Ownership>
+List<T, Ownership>&
+List<T, Ownership>::Append(const List<T, Ownership>& list)
 {
+    this->CheckShareable();
+
     ConstIterator end = list.End();
 
     for (ConstIterator p = list.Begin(); p != end; ++p)
@@ -599,8 +622,8 @@ List<T>& List<T>::Append(const List<T>& list)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-bool List<T>::Remove(const T& data)
+template <class T, class Ownership>
+bool List<T, Ownership>::Remove(const T& data)
 {
     Iterator p = Find(data);
 
@@ -613,8 +636,8 @@ bool List<T>::Remove(const T& data)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-bool List<T>::RemoveRef(T* data)
+template <class T, class Ownership>
+bool List<T, Ownership>::RemoveRef(T* data)
 {
     Iterator p = FindRef(data);
 
@@ -627,15 +650,15 @@ bool List<T>::RemoveRef(T* data)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-T* List<T>::Take(Iterator& pos)
+template <class T, class Ownership>
+T* List<T, Ownership>::Take(Iterator& pos)
 {
     Node* node = static_cast<Node*>(pos.m_node);
     T* data = node->data;
 
     ++pos;
     UnlinkNode(node);
-    delete node;
+    m_pool.Free(node);
     --m_count;
 
     return data;
@@ -643,9 +666,9 @@ T* List<T>::Take(Iterator& pos)
 
 //----------------------------------------------------------------------------
 
-template <class T>
+template <class T, class Ownership>
 template <class Fn>
-void List<T>::DoForEach(Fn fn) const
+void List<T, Ownership>::DoForEach(Fn fn) const
 {
     ConstIterator p = Begin();
     ConstIterator end = End();
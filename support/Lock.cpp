@@ -0,0 +1,20 @@
+#include "support/Lock.h"
+
+#ifdef _WIN32
+#include "platform/Win.h"
+#else
+#include <sched.h>
+#endif
+
+//----------------------------------------------------------------------------
+
+void YieldThread()
+{
+#ifdef _WIN32
+    SwitchToThread();
+#else
+    sched_yield();
+#endif
+}
+
+//----------------------------------------------------------------------------
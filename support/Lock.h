@@ -0,0 +1,261 @@
+#ifndef support_Lock_h
+#define support_Lock_h
+
+#include "support/Atomic.h"
+#include "support/Utilities.h"
+
+//----------------------------------------------------------------------------
+//
+//  Gibt den Rest der Zeitscheibe des aktuellen Threads an einen anderen
+//  rechenbereiten Thread ab.
+//
+void YieldThread();
+
+//----------------------------------------------------------------------------
+//
+//  Wartestrategie der Sperren.
+//
+//  Die ersten SPIN_LIMIT Aufrufe von Wait() warten aktiv mit CpuRelax().
+//  Danach gibt jeder Aufruf die Zeitscheibe ab: Wurde der Besitzer der
+//  Sperre verdraengt, kann er so weiterlaufen, anstatt dass der Wartende
+//  seine ganze Zeitscheibe verbraucht.
+//
+class SpinWait
+{
+public:
+
+    static const uint SPIN_LIMIT = 64;
+
+    SpinWait()
+        : m_spins(0) {}
+
+    void Wait()
+    {
+        if (m_spins < SPIN_LIMIT)
+        {
+            ++m_spins;
+            CpuRelax();
+        }
+        else
+            YieldThread();
+    }
+
+private:
+
+    uint m_spins;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Einfache Sperre fuer kurze kritische Abschnitte.
+//
+//  Ein SpinLock wartet zunaechst aktiv und gibt erst nach einer Weile die
+//  Zeitscheibe ab (siehe SpinWait), anstatt den Thread schlafen zu legen.
+//  Er eignet sich daher nur fuer Abschnitte, die wenige Anweisungen lang
+//  sind und selten umkaempft werden.
+//
+class SpinLock
+{
+public:
+
+    SpinLock()
+        : m_locked(false) {}
+
+    //
+    //  Wartet, bis die Sperre frei ist, und belegt sie.
+    //
+    void Lock()
+    {
+        SpinWait spin;
+
+        while (m_locked.Exchange(true, MEMORY_ORDER_ACQUIRE))
+        {
+            while (m_locked.Load(MEMORY_ORDER_RELAXED))
+                spin.Wait();
+        }
+    }
+
+    //
+    //  Belegt die Sperre, wenn sie frei ist. Die Funktion liefert true, wenn
+    //  die Sperre belegt wurde, sonst false.
+    //
+    bool TryLock()
+    { return !m_locked.Exchange(true, MEMORY_ORDER_ACQUIRE); }
+
+    //
+    //  Gibt die Sperre frei.
+    //
+    void Unlock()
+    { m_locked.Store(false, MEMORY_ORDER_RELEASE); }
+
+private:
+
+    SpinLock(const SpinLock&);
+    SpinLock& operator=(const SpinLock&);
+
+    Atomic<bool> m_locked;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Sperre, die beliebig viele Leser oder genau einen Schreiber zulaesst.
+//
+//  Wie SpinLock wartet auch ReadWriteLock aktiv (siehe SpinWait). Der
+//  Zustand wird in einem einzigen Wort gehalten, so dass das Belegen und
+//  Freigeben einer Lesesperre im unumkaempften Fall je eine atomare
+//  Operation kostet. Da jeder Leser dieses Wort schreibt, wandert die
+//  Cache-Zeile zwischen den Prozessoren, sobald mehrere Threads dieselbe
+//  Sperre lesend belegen; Leser schliessen sich zwar nicht aus, skalieren
+//  aber auch nicht mit der Zahl der Prozessoren.
+//
+//  Wartende Schreiber haben Vorrang: Sobald ein Schreiber wartet, werden
+//  keine neuen Leser mehr zugelassen.
+//
+class ReadWriteLock
+{
+public:
+
+    ReadWriteLock()
+        : m_state(0) {}
+
+    //
+    //  Belegt bzw. gibt eine Lesesperre frei.
+    //
+    void LockRead();
+
+    void UnlockRead()
+    { m_state.FetchSub(1, MEMORY_ORDER_RELEASE); }
+
+    //
+    //  Belegt bzw. gibt eine Schreibsperre frei.
+    //
+    void LockWrite();
+
+    void UnlockWrite()
+    { m_state.FetchAnd(~WRITER, MEMORY_ORDER_RELEASE); }
+
+private:
+
+    ReadWriteLock(const ReadWriteLock&);
+    ReadWriteLock& operator=(const ReadWriteLock&);
+
+    //
+    //  Die unteren Bits von m_state zaehlen die aktiven Leser.
+    //
+    static const uint   WRITER  = 0x80000000u;
+    static const uint   WAITING = 0x40000000u;
+
+    Atomic<uint> m_state;
+};
+
+//----------------------------------------------------------------------------
+
+inline void ReadWriteLock::LockRead()
+{
+    SpinWait spin;
+
+    for (;;)
+    {
+        uint state = m_state.Load(MEMORY_ORDER_RELAXED);
+
+        if ((state & (WRITER | WAITING)) == 0
+            && m_state.CompareExchange(state, state + 1,
+                                       MEMORY_ORDER_ACQUIRE))
+        {
+            return;
+        }
+
+        spin.Wait();
+    }
+}
+
+//----------------------------------------------------------------------------
+
+inline void ReadWriteLock::LockWrite()
+{
+    SpinWait spin;
+
+    for (;;)
+    {
+        uint state = m_state.Load(MEMORY_ORDER_RELAXED);
+
+        if ((state & ~WAITING) == 0)
+        {
+            if (m_state.CompareExchange(state, WRITER, MEMORY_ORDER_ACQUIRE))
+                return;
+        }
+        else if ((state & WAITING) == 0)
+        {
+            m_state.CompareExchange(state, state | WAITING,
+                                    MEMORY_ORDER_RELAXED);
+        }
+
+        spin.Wait();
+    }
+}
+
+//----------------------------------------------------------------------------
+//
+//  Hilfsklassen, die eine Sperre im Konstruktor belegen und im Destruktor
+//  wieder freigeben.
+//
+class SpinLocker
+{
+public:
+
+    explicit SpinLocker(SpinLock& lock)
+        : m_lock(lock)
+    { m_lock.Lock(); }
+
+    ~SpinLocker()
+    { m_lock.Unlock(); }
+
+private:
+
+    SpinLocker(const SpinLocker&);
+    SpinLocker& operator=(const SpinLocker&);
+
+    SpinLock& m_lock;
+};
+
+class ReadLocker
+{
+public:
+
+    explicit ReadLocker(ReadWriteLock& lock)
+        : m_lock(lock)
+    { m_lock.LockRead(); }
+
+    ~ReadLocker()
+    { m_lock.UnlockRead(); }
+
+private:
+
+    ReadLocker(const ReadLocker&);
+    ReadLocker& operator=(const ReadLocker&);
+
+    ReadWriteLock& m_lock;
+};
+
+class WriteLocker
+{
+public:
+
+    explicit WriteLocker(ReadWriteLock& lock)
+        : m_lock(lock)
+    { m_lock.LockWrite(); }
+
+    ~WriteLocker()
+    { m_lock.UnlockWrite(); }
+
+private:
+
+    WriteLocker(const WriteLocker&);
+    WriteLocker& operator=(const WriteLocker&);
+
+    ReadWriteLock& m_lock;
+};
+
+//----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,173 @@
+#ifndef support_NodePool_h
+#define support_NodePool_h
+
+#include "support/Utilities.h"
+
+#include <new>
+
+//----------------------------------------------------------------------------
+//
+//  Template-Klasse, die Speicher fuer Objekte fester Groesse verwaltet.
+//
+//  Listen und Dictionaries legen fuer jedes Element einen eigenen Knoten an.
+//  Statt jeden Knoten einzeln mit new anzufordern, holt ein NodePool den
+//  Speicher in Bloecken (Slabs) fuer mehrere Knoten auf einmal. Freigegebene
+//  Knoten werden in einer Freiliste gesammelt und beim naechsten Allocate()
+//  wiederverwendet, so dass staendiges Einfuegen und Entfernen ohne Zugriff
+//  auf den Heap auskommt. Die Bloecke werden erst von Clear() bzw. vom
+//  Destruktor freigegeben.
+//
+//  Die Groesse der Bloecke beginnt bei MIN_SLAB_NODES Knoten und verdoppelt
+//  sich bis MAX_SLAB_NODES, damit kleine Collections nur wenig Speicher
+//  belegen.
+//
+//  Ein NodePool ist nicht thread-sicher und sollte zu genau einer Collection
+//  gehoeren.
+//
+template <class T>
+class NodePool
+{
+public:
+
+    static const uint   MIN_SLAB_NODES  = 4;
+    static const uint   MAX_SLAB_NODES  = 256;
+
+    //
+    //  Erstellt einen leeren Pool. Speicher wird erst beim ersten Aufruf
+    //  von Allocate() angefordert.
+    //
+    NodePool()
+        : m_slabs(nullptr), m_freeList(nullptr), m_slabNodes(MIN_SLAB_NODES)
+    {}
+
+    //
+    //  Gibt alle Bloecke frei. Alle Knoten muessen vorher mit Free()
+    //  zurueckgegeben worden sein.
+    //
+    ~NodePool()
+    { Clear(); }
+
+    //
+    //  Liefert uninitialisierten Speicher fuer ein Objekt vom Typ T. Das
+    //  Objekt muss mit placement new darin erzeugt werden.
+    //
+    void* Allocate();
+
+    //
+    //  Zerstoert das mit Allocate() angelegte Objekt node und gibt seinen
+    //  Speicher an den Pool zurueck.
+    //
+    void Free(T* node);
+
+    //
+    //  Gibt alle Bloecke an den Heap zurueck. Es duerfen keine Knoten mehr
+    //  in Benutzung sein; ihre Destruktoren werden nicht aufgerufen.
+    //
+    void Clear();
+
+private:
+
+    NodePool(const NodePool<T>&);
+    NodePool<T>& operator=(const NodePool<T>&);
+
+    //
+    //  Kopf eines Blocks. Die Union sorgt dafuer, dass die dahinter
+    //  liegenden Knoten ausreichend ausgerichtet sind.
+    //
+    union Slab
+    {
+        Slab*       next;
+        double      align1;
+        long long   align2;
+    };
+
+    //
+    //  Ein freier Knoten speichert in seinem Speicher den Zeiger auf den
+    //  naechsten freien Knoten.
+    //
+    union FreeNode
+    {
+        FreeNode*   next;
+        char        node[sizeof(T)];
+    };
+
+    //
+    //  Fordert einen neuen Block an und haengt seine Knoten in die
+    //  Freiliste ein.
+    //
+    void Grow();
+
+    Slab*       m_slabs;
+    FreeNode*   m_freeList;
+    uint        m_slabNodes;
+};
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void* NodePool<T>::Allocate()
+{
+    if (m_freeList == nullptr)
+        Grow();
+
+    FreeNode* node = m_freeList;
+    m_freeList = node->next;
+
+    return node;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void NodePool<T>::Free(T* node)
+{
+    node->~T();
+
+    FreeNode* free_node = reinterpret_cast<FreeNode*>(node);
+    free_node->next = m_freeList;
+    m_freeList = free_node;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void NodePool<T>::Clear()
+{
+    while (m_slabs != nullptr)
+    {
+        Slab* slab = m_slabs;
+        m_slabs = slab->next;
+        ::operator delete(slab);
+    }
+
+    m_freeList = nullptr;
+    m_slabNodes = MIN_SLAB_NODES;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void NodePool<T>::Grow()
+{
+    uint count = m_slabNodes;
+    Slab* slab = static_cast<Slab*>(
+        ::operator new(sizeof(Slab) + count * sizeof(FreeNode)));
+
+    slab->next = m_slabs;
+    m_slabs = slab;
+
+    FreeNode* nodes = reinterpret_cast<FreeNode*>(slab + 1);
+
+    for (uint i = count; i > 0; --i)
+    {
+        nodes[i - 1].next = m_freeList;
+        m_freeList = &nodes[i - 1];
+    }
+
+    if (m_slabNodes < MAX_SLAB_NODES)
+        m_slabNodes *= 2;
+}
+
+//----------------------------------------------------------------------------
+
+#endif
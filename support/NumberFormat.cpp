@@ -0,0 +1,520 @@
+#include "support/NumberFormat.h"
+#include "support/Utilities.h"
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+//
+//  Die zweistelligen Dezimalzahlen 00 bis 99. Ganze Zahlen werden in
+//  Schritten von zwei Ziffern umgewandelt, das halbiert die Anzahl der
+//  Divisionen.
+//
+static const char _digit_pairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+//----------------------------------------------------------------------------
+//
+//  Schreibt die Ziffern von value rueckwaerts vor end und liefert einen
+//  Zeiger auf die erste Ziffer.
+//
+static char* WriteDigitsBackward(char* end, ulong value)
+{
+    while (value >= 100)
+    {
+        uint pair = uint(value % 100) * 2;
+        value /= 100;
+
+        *--end = _digit_pairs[pair + 1];
+        *--end = _digit_pairs[pair];
+    }
+
+    if (value >= 10)
+    {
+        uint pair = uint(value) * 2;
+
+        *--end = _digit_pairs[pair + 1];
+        *--end = _digit_pairs[pair];
+    }
+    else
+    {
+        *--end = char('0' + value);
+    }
+
+    return end;
+}
+
+//----------------------------------------------------------------------------
+
+static uint FormatUnsigned(char* buffer, ulong value, bool negative)
+{
+    char digits[NUMBER_BUFFER_SIZE];
+    char* end = digits + sizeof(digits);
+    char* first = WriteDigitsBackward(end, value);
+
+    if (negative)
+        *--first = '-';
+
+    uint length = end - first;
+
+    memcpy(buffer, first, length);
+    buffer[length] = '\0';
+
+    return length;
+}
+
+//----------------------------------------------------------------------------
+
+uint FormatInteger(char* buffer, int value)
+{
+    return value < 0
+        ? FormatUnsigned(buffer, 0u - uint(value), true)
+        : FormatUnsigned(buffer, uint(value), false);
+}
+
+//----------------------------------------------------------------------------
+
+uint FormatInteger(char* buffer, uint value)
+{
+    return FormatUnsigned(buffer, value, false);
+}
+
+//----------------------------------------------------------------------------
+
+uint FormatInteger(char* buffer, long value)
+{
+    return value < 0
+        ? FormatUnsigned(buffer, 0ul - ulong(value), true)
+        : FormatUnsigned(buffer, ulong(value), false);
+}
+
+//----------------------------------------------------------------------------
+
+uint FormatInteger(char* buffer, ulong value)
+{
+    return FormatUnsigned(buffer, value, false);
+}
+
+//----------------------------------------------------------------------------
+//
+//  Gleitkommazahl f * 2^e mit 64-Bit-Mantisse fuer den Grisu-Algorithmus
+//  (Florian Loitsch, "Printing Floating-Point Numbers Quickly and
+//  Accurately with Integers", PLDI 2010).
+//
+struct DiyFp
+{
+    DiyFp() {}
+
+    DiyFp(ulonglong f, int e)
+        : f(f), e(e) {}
+
+    ulonglong   f;
+    int         e;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Normalisierte Naeherungen der Zehnerpotenzen 10^-348, 10^-340, ...,
+//  10^340. Erzeugt durch exakte Rechnung und Rundung auf 64 Bit.
+//
+struct CachedPower
+{
+    ulonglong   f;
+    int         e;
+};
+
+static const CachedPower _cached_powers[] =
+{
+    { 0xfa8fd5a0081c0288ull, -1220 }, { 0xbaaee17fa23ebf76ull, -1193 },
+    { 0x8b16fb203055ac76ull, -1166 }, { 0xcf42894a5dce35eaull, -1140 },
+    { 0x9a6bb0aa55653b2dull, -1113 }, { 0xe61acf033d1a45dfull, -1087 },
+    { 0xab70fe17c79ac6caull, -1060 }, { 0xff77b1fcbebcdc4full, -1034 },
+    { 0xbe5691ef416bd60cull, -1007 }, { 0x8dd01fad907ffc3cull,  -980 },
+    { 0xd3515c2831559a83ull,  -954 }, { 0x9d71ac8fada6c9b5ull,  -927 },
+    { 0xea9c227723ee8bcbull,  -901 }, { 0xaecc49914078536dull,  -874 },
+    { 0x823c12795db6ce57ull,  -847 }, { 0xc21094364dfb5637ull,  -821 },
+    { 0x9096ea6f3848984full,  -794 }, { 0xd77485cb25823ac7ull,  -768 },
+    { 0xa086cfcd97bf97f4ull,  -741 }, { 0xef340a98172aace5ull,  -715 },
+    { 0xb23867fb2a35b28eull,  -688 }, { 0x84c8d4dfd2c63f3bull,  -661 },
+    { 0xc5dd44271ad3cdbaull,  -635 }, { 0x936b9fcebb25c996ull,  -608 },
+    { 0xdbac6c247d62a584ull,  -582 }, { 0xa3ab66580d5fdaf6ull,  -555 },
+    { 0xf3e2f893dec3f126ull,  -529 }, { 0xb5b5ada8aaff80b8ull,  -502 },
+    { 0x87625f056c7c4a8bull,  -475 }, { 0xc9bcff6034c13053ull,  -449 },
+    { 0x964e858c91ba2655ull,  -422 }, { 0xdff9772470297ebdull,  -396 },
+    { 0xa6dfbd9fb8e5b88full,  -369 }, { 0xf8a95fcf88747d94ull,  -343 },
+    { 0xb94470938fa89bcfull,  -316 }, { 0x8a08f0f8bf0f156bull,  -289 },
+    { 0xcdb02555653131b6ull,  -263 }, { 0x993fe2c6d07b7facull,  -236 },
+    { 0xe45c10c42a2b3b06ull,  -210 }, { 0xaa242499697392d3ull,  -183 },
+    { 0xfd87b5f28300ca0eull,  -157 }, { 0xbce5086492111aebull,  -130 },
+    { 0x8cbccc096f5088ccull,  -103 }, { 0xd1b71758e219652cull,   -77 },
+    { 0x9c40000000000000ull,   -50 }, { 0xe8d4a51000000000ull,   -24 },
+    { 0xad78ebc5ac620000ull,     3 }, { 0x813f3978f8940984ull,    30 },
+    { 0xc097ce7bc90715b3ull,    56 }, { 0x8f7e32ce7bea5c70ull,    83 },
+    { 0xd5d238a4abe98068ull,   109 }, { 0x9f4f2726179a2245ull,   136 },
+    { 0xed63a231d4c4fb27ull,   162 }, { 0xb0de65388cc8ada8ull,   189 },
+    { 0x83c7088e1aab65dbull,   216 }, { 0xc45d1df942711d9aull,   242 },
+    { 0x924d692ca61be758ull,   269 }, { 0xda01ee641a708deaull,   295 },
+    { 0xa26da3999aef774aull,   322 }, { 0xf209787bb47d6b85ull,   348 },
+    { 0xb454e4a179dd1877ull,   375 }, { 0x865b86925b9bc5c2ull,   402 },
+    { 0xc83553c5c8965d3dull,   428 }, { 0x952ab45cfa97a0b3ull,   455 },
+    { 0xde469fbd99a05fe3ull,   481 }, { 0xa59bc234db398c25ull,   508 },
+    { 0xf6c69a72a3989f5cull,   534 }, { 0xb7dcbf5354e9beceull,   561 },
+    { 0x88fcf317f22241e2ull,   588 }, { 0xcc20ce9bd35c78a5ull,   614 },
+    { 0x98165af37b2153dfull,   641 }, { 0xe2a0b5dc971f303aull,   667 },
+    { 0xa8d9d1535ce3b396ull,   694 }, { 0xfb9b7cd9a4a7443cull,   720 },
+    { 0xbb764c4ca7a44410ull,   747 }, { 0x8bab8eefb6409c1aull,   774 },
+    { 0xd01fef10a657842cull,   800 }, { 0x9b10a4e5e9913129ull,   827 },
+    { 0xe7109bfba19c0c9dull,   853 }, { 0xac2820d9623bf429ull,   880 },
+    { 0x80444b5e7aa7cf85ull,   907 }, { 0xbf21e44003acdd2dull,   933 },
+    { 0x8e679c2f5e44ff8full,   960 }, { 0xd433179d9c8cb841ull,   986 },
+    { 0x9e19db92b4e31ba9ull,  1013 }, { 0xeb96bf6ebadf77d9ull,  1039 },
+    { 0xaf87023b9bf0ee6bull,  1066 }
+};
+
+//----------------------------------------------------------------------------
+
+static const uint _pow10[] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000,
+    1000000000
+};
+
+//----------------------------------------------------------------------------
+//
+//  Verschiebt die Mantisse von v, bis ihr hoechstes Bit gesetzt ist.
+//
+static DiyFp Normalize(DiyFp v)
+{
+    while ((v.f & (1ull << 63)) == 0)
+    {
+        v.f <<= 1;
+        --v.e;
+    }
+
+    return v;
+}
+
+//----------------------------------------------------------------------------
+//
+//  Multipliziert x und y und rundet das Ergebnis auf 64 Bit.
+//
+static DiyFp Multiply(const DiyFp& x, const DiyFp& y)
+{
+    const ulonglong mask = 0xffffffffull;
+
+    ulonglong a = x.f >> 32;
+    ulonglong b = x.f & mask;
+    ulonglong c = y.f >> 32;
+    ulonglong d = y.f & mask;
+
+    ulonglong ac = a * c;
+    ulonglong bc = b * c;
+    ulonglong ad = a * d;
+    ulonglong bd = b * d;
+
+    ulonglong middle = (bd >> 32) + (ad & mask) + (bc & mask) + (1ull << 31);
+
+    return DiyFp(ac + (ad >> 32) + (bc >> 32) + (middle >> 32),
+                 x.e + y.e + 64);
+}
+
+//----------------------------------------------------------------------------
+//
+//  Liefert eine Zehnerpotenz 10^-K, deren Produkt mit einer normalisierten
+//  Zahl mit dem Exponenten e einen Exponenten zwischen -60 und -32 hat.
+//
+static DiyFp GetCachedPower(int e, int& K)
+{
+    double dk = (-61 - e) * 0.30102999566398114 + 347;
+    int k = int(dk);
+
+    if (dk - k > 0.0)
+        ++k;
+
+    uint index = uint((k >> 3) + 1);
+    K = -(-348 + int(index << 3));
+
+    return DiyFp(_cached_powers[index].f, _cached_powers[index].e);
+}
+
+//----------------------------------------------------------------------------
+
+static uint CountDecimalDigits(uint n)
+{
+    uint count = 1;
+
+    while (count < 10 && n >= _pow10[count])
+        ++count;
+
+    return count;
+}
+
+//----------------------------------------------------------------------------
+//
+//  Verringert die letzte Ziffer, solange die Zahl dadurch naeher an den
+//  exakten Wert rueckt und im zulaessigen Intervall bleibt.
+//
+static void GrisuRound(char* digits, int length, ulonglong delta,
+                       ulonglong rest, ulonglong ten_kappa, ulonglong wp_w)
+{
+    while (rest < wp_w && delta - rest >= ten_kappa
+           && (rest + ten_kappa < wp_w
+               || wp_w - rest > rest + ten_kappa - wp_w))
+    {
+        --digits[length - 1];
+        rest += ten_kappa;
+    }
+}
+
+//----------------------------------------------------------------------------
+//
+//  Erzeugt die kuerzeste Ziffernfolge im Intervall (high - delta, high],
+//  die w moeglichst nahe kommt.
+//
+static void DigitGen(const DiyFp& w, const DiyFp& high, ulonglong delta,
+                     char* digits, int& length, int& K)
+{
+    const DiyFp one(1ull << -high.e, high.e);
+    const ulonglong wp_w = high.f - w.f;
+
+    uint p1 = uint(high.f >> -one.e);
+    ulonglong p2 = high.f & (one.f - 1);
+    int kappa = CountDecimalDigits(p1);
+
+    length = 0;
+
+    while (kappa > 0)
+    {
+        uint divisor = _pow10[kappa - 1];
+        uint digit = p1 / divisor;
+        p1 %= divisor;
+
+        if (digit != 0 || length != 0)
+            digits[length++] = char('0' + digit);
+
+        --kappa;
+
+        ulonglong rest = (ulonglong(p1) << -one.e) + p2;
+
+        if (rest <= delta)
+        {
+            K += kappa;
+            GrisuRound(digits, length, delta, rest,
+                       ulonglong(_pow10[kappa]) << -one.e, wp_w);
+            return;
+        }
+    }
+
+    for (;;)
+    {
+        p2 *= 10;
+        delta *= 10;
+
+        char digit = char(p2 >> -one.e);
+
+        if (digit != 0 || length != 0)
+            digits[length++] = char('0' + digit);
+
+        p2 &= one.f - 1;
+        --kappa;
+
+        if (p2 < delta)
+        {
+            K += kappa;
+
+            int index = -kappa;
+            GrisuRound(digits, length, delta, p2, one.f,
+                       wp_w * (index < 10 ? _pow10[index] : 0));
+            return;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+//
+//  Erzeugt fuer die positive Zahl v eine Ziffernfolge digits mit
+//  v = digits * 10^K, die beim Einlesen wieder genau v ergibt. Grisu2
+//  sucht dabei in einem etwas verkleinerten Intervall und liefert daher in
+//  seltenen Faellen eine Stelle mehr als noetig. lowerCloser gibt an, ob
+//  der naechstkleinere darstellbare Wert naeher liegt als der
+//  naechstgroessere; das ist bei Zweierpotenzen der Fall.
+//
+static void Grisu2(const DiyFp& v, bool lowerCloser, char* digits,
+                   int& length, int& K)
+{
+    DiyFp plus = Normalize(DiyFp((v.f << 1) + 1, v.e - 1));
+    DiyFp minus = lowerCloser
+        ? DiyFp((v.f << 2) - 1, v.e - 2)
+        : DiyFp((v.f << 1) - 1, v.e - 1);
+
+    minus.f <<= minus.e - plus.e;
+    minus.e = plus.e;
+
+    DiyFp c_mk = GetCachedPower(plus.e, K);
+    DiyFp w = Multiply(Normalize(v), c_mk);
+    DiyFp high = Multiply(plus, c_mk);
+    DiyFp low = Multiply(minus, c_mk);
+
+    ++low.f;
+    --high.f;
+
+    DigitGen(w, high, high.f - low.f, digits, length, K);
+}
+
+//----------------------------------------------------------------------------
+//
+//  Schreibt die Zahl digits * 10^K nach buffer. Zahlen, deren Betrag
+//  zwischen 10^-6 und 10^21 liegt, werden ohne Exponent dargestellt.
+//
+static uint FormatDecimal(char* buffer, const char* digits, int length,
+                          int K)
+{
+    char* p = buffer;
+    int point = length + K;
+
+    if (length <= point && point <= 21)
+    {
+        memcpy(p, digits, length);
+        p += length;
+        memset(p, '0', point - length);
+        p += point - length;
+    }
+    else if (0 < point && point <= 21)
+    {
+        memcpy(p, digits, point);
+        p += point;
+        *p++ = '.';
+        memcpy(p, digits + point, length - point);
+        p += length - point;
+    }
+    else if (-6 < point && point <= 0)
+    {
+        *p++ = '0';
+        *p++ = '.';
+        memset(p, '0', -point);
+        p += -point;
+        memcpy(p, digits, length);
+        p += length;
+    }
+    else
+    {
+        int exponent = point - 1;
+
+        *p++ = digits[0];
+
+        if (length > 1)
+        {
+            *p++ = '.';
+            memcpy(p, digits + 1, length - 1);
+            p += length - 1;
+        }
+
+        *p++ = 'e';
+        *p++ = exponent < 0 ? '-' : '+';
+
+        if (exponent < 0)
+            exponent = -exponent;
+
+        if (exponent < 10)
+            *p++ = '0';
+
+        p += FormatUnsigned(p, exponent, false);
+    }
+
+    *p = '\0';
+    return p - buffer;
+}
+
+//----------------------------------------------------------------------------
+//
+//  Gemeinsame Umwandlung fuer float und double. significand und exponent
+//  sind die Bitfelder der Zahl, mantissaBits die Anzahl der Bits der
+//  Mantisse ohne das implizite fuehrende Bit.
+//
+static uint FormatRoundTrip(char* buffer, bool negative,
+                            ulonglong significand, uint exponent,
+                            uint mantissaBits, uint maxExponent, int bias)
+{
+    char* p = buffer;
+
+    if (negative)
+        *p++ = '-';
+
+    if (exponent == maxExponent)
+    {
+        strcpy(p, significand != 0 ? "nan" : "inf");
+        return p - buffer + 3;
+    }
+
+    if (exponent == 0 && significand == 0)
+    {
+        strcpy(p, "0");
+        return p - buffer + 1;
+    }
+
+    DiyFp v = exponent != 0
+        ? DiyFp(significand | (1ull << mantissaBits), int(exponent) - bias)
+        : DiyFp(significand, 1 - bias);
+
+    char digits[20];
+    int length;
+    int K;
+
+    Grisu2(v, significand == 0 && exponent > 1, digits, length, K);
+    return p - buffer + FormatDecimal(p, digits, length, K);
+}
+
+//----------------------------------------------------------------------------
+//
+//  Rundet value auf digits signifikante Stellen. Das Dezimalzeichen von
+//  printf() haengt vom Locale ab und wird durch einen Punkt ersetzt.
+//
+static uint FormatPrecision(char* buffer, double value, int digits)
+{
+    int length = snprintf(buffer, NUMBER_BUFFER_SIZE, "%.*g",
+                          Min(digits, 17), value);
+
+    for (char* p = buffer; *p != '\0'; ++p)
+    {
+        if (*p != '-' && *p != '+' && !isalnum((uchar) *p))
+            *p = '.';
+    }
+
+    return length;
+}
+
+//----------------------------------------------------------------------------
+
+uint FormatFloat(char* buffer, float value, int digits)
+{
+    if (digits > 0)
+        return FormatPrecision(buffer, value, digits);
+
+    uint bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    return FormatRoundTrip(buffer, (bits >> 31) != 0, bits & 0x7fffff,
+                           (bits >> 23) & 0xff, 23, 0xff, 127 + 23);
+}
+
+//----------------------------------------------------------------------------
+
+uint FormatDouble(char* buffer, double value, int digits)
+{
+    if (digits > 0)
+        return FormatPrecision(buffer, value, digits);
+
+    ulonglong bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    return FormatRoundTrip(buffer, (bits >> 63) != 0,
+                           bits & ((1ull << 52) - 1),
+                           uint(bits >> 52) & 0x7ff, 52, 0x7ff, 1023 + 52);
+}
+
+//----------------------------------------------------------------------------
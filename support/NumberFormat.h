@@ -0,0 +1,56 @@
+#ifndef support_NumberFormat_h
+#define support_NumberFormat_h
+
+#include "support/Utilities.h"
+
+//----------------------------------------------------------------------------
+//
+//  Groesse eines Puffers, der jede von den Format-Funktionen erzeugte
+//  Zeichenkette einschliesslich des abschliessenden Nullzeichens aufnehmen
+//  kann.
+//
+enum { NUMBER_BUFFER_SIZE = 32 };
+
+//----------------------------------------------------------------------------
+//
+//  Voreinstellung fuer die Anzahl signifikanter Stellen, mit der
+//  Gleitkommazahlen formatiert werden (FormatFloat(), FormatDouble(),
+//  ToString() und StringBuilder::AppendNumber()).
+//
+enum { DEFAULT_FLOAT_DIGITS = 4 };
+
+//----------------------------------------------------------------------------
+//
+//  Schreiben die Dezimaldarstellung von value nach buffer, schliessen sie
+//  mit einem Nullzeichen ab und liefern ihre Laenge. buffer muss
+//  NUMBER_BUFFER_SIZE Zeichen aufnehmen koennen.
+//
+//  Die Funktionen verwenden keinen globalen Zustand und koennen gleichzeitig
+//  in mehreren Threads aufgerufen werden.
+//
+uint FormatInteger(char* buffer, int value);
+uint FormatInteger(char* buffer, uint value);
+uint FormatInteger(char* buffer, long value);
+uint FormatInteger(char* buffer, ulong value);
+
+//----------------------------------------------------------------------------
+//
+//  Schreiben die Dezimaldarstellung der Gleitkommazahl value nach buffer,
+//  schliessen sie mit einem Nullzeichen ab und liefern ihre Laenge. buffer
+//  muss NUMBER_BUFFER_SIZE Zeichen aufnehmen koennen.
+//
+//  Ist digits groesser als 0, wird value wie mit printf("%.*g") auf digits
+//  signifikante Stellen (hoechstens 17) gerundet. Ist digits gleich 0, wird
+//  eine Darstellung erzeugt, die beim Einlesen exakt wieder value ergibt
+//  (Grisu2). Sie ist fast immer die kuerzeste, in seltenen Faellen jedoch
+//  eine Stelle laenger. Als Dezimalzeichen wird unabhaengig vom
+//  eingestellten Locale immer ein Punkt verwendet.
+//
+uint FormatFloat(char* buffer, float value,
+                 int digits = DEFAULT_FLOAT_DIGITS);
+uint FormatDouble(char* buffer, double value,
+                  int digits = DEFAULT_FLOAT_DIGITS);
+
+//----------------------------------------------------------------------------
+
+#endif
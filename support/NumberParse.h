@@ -0,0 +1,63 @@
+#ifndef support_NumberParse_h
+#define support_NumberParse_h
+
+#include "support/Utilities.h"
+
+//----------------------------------------------------------------------------
+//
+//  Ergebnis der Parse-Funktionen.
+//
+enum ParseError
+{
+    PARSE_OK,               // Zahl erkannt und gespeichert
+    PARSE_INVALID,          // keine Zahl am Anfang der Zeichenfolge
+    PARSE_OUT_OF_RANGE      // Zahl erkannt, aber nicht darstellbar
+};
+
+//
+//  end zeigt hinter das letzte Zeichen der erkannten Zahl. Bei
+//  PARSE_INVALID ist end gleich dem Anfang der Zeichenfolge.
+//
+struct ParseResult
+{
+    const char* end;
+    ParseError  error;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Lesen eine ganze Zahl aus der Zeichenfolge [first, last). Die Zahl muss
+//  am Anfang stehen und besteht aus Dezimalziffern, bei vorzeichenbehafteten
+//  Typen mit einem optionalen '-' davor. Leerzeichen und '+' werden nicht
+//  uebersprungen, und die Zeichenfolge muss nicht Null-terminiert sein.
+//  value wird nur bei PARSE_OK veraendert.
+//
+ParseResult ParseInteger(const char* first, const char* last, int& value);
+ParseResult ParseInteger(const char* first, const char* last, uint& value);
+ParseResult ParseInteger(const char* first, const char* last, long& value);
+ParseResult ParseInteger(const char* first, const char* last, ulong& value);
+
+//----------------------------------------------------------------------------
+//
+//  Lesen eine Gleitkommazahl aus der Zeichenfolge [first, last). Erkannt
+//  werden ein optionales '-', Ziffern mit einem optionalen Punkt als
+//  Dezimalzeichen und ein optionaler Exponent (e oder E, optionales
+//  Vorzeichen, Ziffern) sowie "inf", "infinity" und "nan" ohne Beachtung
+//  der Gross- und Kleinschreibung. Das eingestellte Locale wird nicht
+//  beachtet. Das Ergebnis ist korrekt gerundet. Zahlen, deren Betrag zu
+//  gross ist oder auf 0 gerundet wuerde, liefern PARSE_OUT_OF_RANGE.
+//  value wird nur bei PARSE_OK veraendert.
+//
+//  Ganze Zahlen unter 2^63 werden exakt umgerechnet. Bei Mantissen bis
+//  2^53 (float: 2^24) und Exponenten bis 22 (float: 10) wird, ausser bei
+//  x87-Arithmetik, mit einer Gleitkommaoperation gerechnet (Clinger).
+//  Uebrige Zahlen mit hoechstens 19 signifikanten Ziffern berechnet der
+//  Eisel-Lemire-Algorithmus mit ganzen Zahlen; nur die verbleibenden
+//  Faelle gehen ueber strtod() bzw. strtof().
+//
+ParseResult ParseFloat(const char* first, const char* last, float& value);
+ParseResult ParseDouble(const char* first, const char* last, double& value);
+
+//----------------------------------------------------------------------------
+
+#endif
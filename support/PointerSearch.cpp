@@ -0,0 +1,148 @@
+#include "support/PointerSearch.h"
+
+#include <cstddef>
+
+#if defined(__i386__) || defined(__x86_64__)
+#include <immintrin.h>
+#define POINTER_SEARCH_SIMD
+#endif
+
+//----------------------------------------------------------------------------
+
+typedef uint (*FindPointerFn)(const void* const*, uint, const void*);
+
+static uint ResolveFindPointer(const void* const* data, uint count,
+                               const void* value);
+
+//  Ein einfacher Funktionszeiger wird statisch initialisiert und ist damit
+//  schon vor den Konstruktoren globaler Objekte gueltig; Atomic<> hat einen
+//  Konstruktor und wuerde erst dynamisch initialisiert. Zugegriffen wird
+//  daher direkt mit __atomic_load_n() und __atomic_store_n().
+
+static FindPointerFn find_pointer = ResolveFindPointer;
+
+//----------------------------------------------------------------------------
+
+static uint FindPointerScalar(const void* const* data, uint count,
+                              const void* value)
+{
+    uint i;
+
+    for (i = 0; i < count; ++i)
+    {
+        if (data[i] == value)
+            break;
+    }
+
+    return i;
+}
+
+//----------------------------------------------------------------------------
+
+#ifdef POINTER_SEARCH_SIMD
+
+__attribute__((target("sse2")))
+static uint FindPointerSSE2(const void* const* data, uint count,
+                            const void* value)
+{
+    const uint lanes = 16 / sizeof(void*);
+    const size_t key = reinterpret_cast<size_t>(value);
+
+    __m128i v_key = sizeof(void*) == 4
+        ? _mm_set1_epi32((int) key)
+        : _mm_set1_epi64x((long long) key);
+
+    uint i = 0;
+
+    for (; i + lanes <= count; i += lanes)
+    {
+        __m128i v = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + i));
+        __m128i eq = _mm_cmpeq_epi32(v, v_key);
+
+        //  SSE2 kennt keinen 64-Bit-Vergleich: Beide Haelften eines Zeigers
+        //  muessen uebereinstimmen.
+        if (sizeof(void*) == 8)
+        {
+            eq = _mm_and_si128(
+                eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+        }
+
+        int mask = _mm_movemask_epi8(eq);
+
+        if (mask != 0)
+            return i + __builtin_ctz(mask) / sizeof(void*);
+    }
+
+    return i + FindPointerScalar(data + i, count - i, value);
+}
+
+//----------------------------------------------------------------------------
+
+__attribute__((target("avx2")))
+static uint FindPointerAVX2(const void* const* data, uint count,
+                            const void* value)
+{
+    const uint lanes = 32 / sizeof(void*);
+    const size_t key = reinterpret_cast<size_t>(value);
+
+    __m256i v_key = sizeof(void*) == 4
+        ? _mm256_set1_epi32((int) key)
+        : _mm256_set1_epi64x((long long) key);
+
+    uint i = 0;
+
+    for (; i + lanes <= count; i += lanes)
+    {
+        __m256i v = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(data + i));
+
+        __m256i eq = sizeof(void*) == 4
+            ? _mm256_cmpeq_epi32(v, v_key)
+            : _mm256_cmpeq_epi64(v, v_key);
+
+        uint mask = (uint) _mm256_movemask_epi8(eq);
+
+        if (mask != 0)
+            return i + __builtin_ctz(mask) / sizeof(void*);
+    }
+
+    return i + FindPointerScalar(data + i, count - i, value);
+}
+
+#endif
+
+//----------------------------------------------------------------------------
+//
+//  Waehlt beim ersten Aufruf die passende Variante fuer den Prozessor aus.
+//  Rufen mehrere Threads die Funktion gleichzeitig auf, treffen sie alle
+//  dieselbe Wahl. find_pointer wird atomar gelesen und geschrieben; da der
+//  Zeiger nur auf Code verweist, genuegt dafuer MEMORY_ORDER_RELAXED.
+//
+static uint ResolveFindPointer(const void* const* data, uint count,
+                               const void* value)
+{
+    FindPointerFn fn = FindPointerScalar;
+
+#ifdef POINTER_SEARCH_SIMD
+    __builtin_cpu_init();
+
+    if (__builtin_cpu_supports("avx2"))
+        fn = FindPointerAVX2;
+    else if (__builtin_cpu_supports("sse2"))
+        fn = FindPointerSSE2;
+#endif
+
+    __atomic_store_n(&find_pointer, fn, __ATOMIC_RELAXED);
+    return fn(data, count, value);
+}
+
+//----------------------------------------------------------------------------
+
+uint FindPointerVectorized(const void* const* data, uint count,
+                           const void* value)
+{
+    return __atomic_load_n(&find_pointer, __ATOMIC_RELAXED)(data, count, value);
+}
+
+//----------------------------------------------------------------------------
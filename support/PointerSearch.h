@@ -0,0 +1,51 @@
+#ifndef support_PointerSearch_h
+#define support_PointerSearch_h
+
+#include "support/Utilities.h"
+
+//----------------------------------------------------------------------------
+//
+//  Liefert den Index des ersten Eintrags im Zeiger-Array [data, data +
+//  count), der gleich value ist, bzw. count, wenn value nicht enthalten
+//  ist.
+//
+//  Die Funktion vergleicht mehrere Zeiger pro Instruktion (SSE2: 16 Byte,
+//  AVX2: 32 Byte). Welche Variante verwendet wird, wird beim ersten Aufruf
+//  anhand der Faehigkeiten des Prozessors entschieden. Steht keine der
+//  Erweiterungen zur Verfuegung, wird eine einfache Schleife verwendet.
+//
+uint FindPointerVectorized(const void* const* data, uint count,
+                           const void* value);
+
+//----------------------------------------------------------------------------
+//
+//  Liefert den Index des ersten Eintrags im Zeiger-Array [data, data +
+//  count), der gleich value ist, bzw. count, wenn value nicht enthalten
+//  ist.
+//
+//  Kurze Arrays werden direkt durchsucht, da sich der Aufruf der
+//  vektorisierten Variante fuer sie nicht lohnt.
+//
+template <class T>
+inline uint FindPointer(T* const* data, uint count, const T* value)
+{
+    if (count >= 16)
+    {
+        return FindPointerVectorized(
+            reinterpret_cast<const void* const*>(data), count, value);
+    }
+
+    uint i;
+
+    for (i = 0; i < count; ++i)
+    {
+        if (data[i] == value)
+            break;
+    }
+
+    return i;
+}
+
+//----------------------------------------------------------------------------
+
+#endif
@@ -1,192 +1,813 @@
-#ifndef support_Signal_h
-#define support_Signal_h
-
-#include "support/Utilities.h"
-
-template <class T>
-class SignalConnection;
-
-template <class T, class Recv>
-class SignalConnectionImpl;
-
-//----------------------------------------------------------------------------
-//
-//  Die Signal-Klasse dient zur Kommunikation zwischen Objekten.
-//
-//  Signale koennen mit typkompatiblen Elementfunktionen (Slots) "verbunden"
-//  werden. Zwischen Signalen und Slots besteht eine n:n - Beziehung. Wird
-//  ein Signal aktiviert, werden alle verbundenen Slots mit dem Parameter
-//  des Signals aufgerufen.
-//
-template <class T>
-class Signal
-{
-public:
-
-    //
-    //  Erstellt ein neues Signal-Objekt. Dabei wird eine (noch leere) Liste
-    //  fuer die zu verbindenden Slots angelegt.
-    //
-    Signal()
-        : m_connections(nullptr) {}
-
-    //
-    //  Zerstoert ein Signal-Objekt. Der fuer die Speicherung der Verbindungen
-    //  reservierte Speicher wird freigegeben.
-    //
-    ~Signal();
-
-    //
-    //  Aktiviert das Signal. Alle verbundenen Slots werden nacheinander mit
-    //  dem Parameter arg aufgerufen.
-    //
-    void operator()(T arg);
-
-    //
-    //  Verbindet das Signal mit dem Slot fn des Objekts receiver. Wird danach
-    //  das Signal aktiviert, wird receiver::fn() aufgerufen.
-    //
-    template <class Recv>
-    void Connect(Recv* receiver, void (Recv::*fn)(T))
-    {
-        m_connections = new SignalConnectionImpl<T, Recv>(
-            receiver, fn, m_connections);
-    }
-
-    //
-    //  Loest die Verbindung zwischen dem Signal und dem Slot fn des Objekts
-    //  receiver. Wird danach das Signal aktiviert, wird receiver::fn() nicht
-    //  mehr aufgerufen.
-    //
-    template <class Recv>
-    void Disconnect(Recv* receiver, void (Recv::*fn)(T));
-
-private:
-
-    //
-    //  Signale koennen nicht kopiert oder zugewiesen werden.
-    //
-    Signal(const Signal<T>&);
-    Signal<T>& operator=(const Signal&);
-
-    SignalConnection<T>* m_connections;
-};
-
-//----------------------------------------------------------------------------
-//
-//  Struktur zur Speicherung einer Verbindung zwischen dem Signal und
-//  einem Slot.
-//
-template <class T>
-struct SignalConnection
-{
-    SignalConnection(void* receiver, SignalConnection<T>* next)
-        : receiver(receiver), next(next) {}
-
-    virtual void EmitSignal(T) = 0;
-
-    void*                   receiver;
-    SignalConnection<T>*    next;
-};
-
-template <class T, class Recv>
-struct SignalConnectionImpl: public SignalConnection<T>
-{
-    typedef void (Recv::*MemberFn)(T);
-
-    SignalConnectionImpl(Recv* receiver, MemberFn fn, SignalConnection<T>* next)
-        : SignalConnection<T>(receiver, next), fn(fn) {}
-
-    void EmitSignal(T arg);
-
-    MemberFn fn;
-};
-
-//----------------------------------------------------------------------------
-//
-//  Verbindet das Signal signal mit dem Slot fn des Objekts receiver. Wird
-//  danach das Signal aktiviert, wird receiver::fn() aufgerufen.
-//
-template <class T, class Recv>
-inline void Connect(Signal<T>& signal, Recv* receiver, void (Recv::*fn)(T))
-{ signal.Connect(receiver, fn); }
-
-//----------------------------------------------------------------------------
-//
-//  Loest die Verbindung zwischen dem Signal signal und dem Slot fn des
-//  Objekts receiver. Wird danach das Signal aktiviert, wird receiver::fn()
-//  nicht mehr aufgerufen.
-//
-template <class T, class Recv>
-inline void Disconnect(Signal<T>& signal, Recv* receiver, void (Recv::*fn)(T))
-{ signal.Disconnect(receiver, fn); }
-
-//----------------------------------------------------------------------------
-
-template <class T>
-Signal<T>::~Signal()
-{
-    SignalConnection<T>** c_ptr = &m_connections;
-
-    while (*c_ptr != nullptr)
-    {
-        SignalConnection<T>* c = *c_ptr;
-        *c_ptr = c->next;
-        delete c;
-    }
-}
-
-//----------------------------------------------------------------------------
-
-template <class T>
-template <class Recv>
-void Signal<T>::Disconnect(Recv* receiver, void (Recv::*fn)(T))
-{
-    SignalConnection<T>** c_ptr = &m_connections;
-
-    while (*c_ptr != nullptr)
-    {
-        SignalConnection<T>* c = *c_ptr;
-
-        if (c->receiver == receiver)
-        {
-            SignalConnectionImpl<T, Recv>* ci =
-                static_cast<SignalConnectionImpl<T, Recv>*>(c);
-
-            if (ci->fn == fn)
-            {
-                *c_ptr = ci->next;
-                delete ci;
-                return;
-            }
-        }
-
-        c_ptr = &c->next;
-    }
-}
-
-//----------------------------------------------------------------------------
-
-template <class T>
-void Signal<T>::operator()(T arg)
-{
-    SignalConnection<T>* c = m_connections;
-
-    while (c != nullptr)
-    {
-        c->EmitSignal(arg);
-        c = c->next;
-    }
-}
-
-//----------------------------------------------------------------------------
-
-template <class T, class Recv>
-void SignalConnectionImpl<T, Recv>::EmitSignal(T arg)
-{
-    (static_cast<Recv*>(this->receiver)->*fn)(arg);
-}
-
-//----------------------------------------------------------------------------
-
-#endif
+#ifndef support_Signal_h
+#define support_Signal_h
+
+#include "support/Atomic.h"
+#include "support/Lock.h"
+#include "support/Utilities.h"
+
+//----------------------------------------------------------------------------
+//
+//  Gemeinsamer Typ, in den Signal die Empfaenger und ihre Slots umwandelt.
+//
+//  Ein Slot void (Recv::*)(T) wird als void (SignalReceiver::*)(T) mit dem
+//  unveraenderten Zeiger auf den Empfaenger gespeichert und ohne
+//  Rueckwandlung aufgerufen. Das setzt die Darstellung von Zeigern auf
+//  Elementfunktionen des Itanium-ABI voraus, die g++ auf allen Plattformen
+//  verwendet: Der Zeiger enthaelt die Anpassung von this und den Eintrag in
+//  der vtable selbst und ist unabhaengig vom Klassentyp gleich gross.
+//
+class SignalReceiver {};
+
+//----------------------------------------------------------------------------
+//
+//  Kennung einer Verbindung, die von Signal::Connect() geliefert wird und
+//  mit Signal::Disconnect() ohne Suche wieder geloest werden kann.
+//
+//  index ist die Position der Verbindung im Signal, serial eine fortlaufende
+//  Nummer, die bei jedem Connect() erhoeht wird. Eine Kennung, deren
+//  Verbindung bereits geloest wurde, bleibt daher wirkungslos, auch wenn
+//  der Platz inzwischen fuer eine neue Verbindung verwendet wird.
+//
+struct SignalConnection
+{
+    SignalConnection()
+        : index(0), serial(0) {}
+
+    SignalConnection(uint index, uint serial)
+        : index(index), serial(serial) {}
+
+    uint    index;
+    uint    serial;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Aktivierung eines Slots, die nicht sofort, sondern spaeter in einem
+//  anderen Thread ausgefuehrt wird.
+//
+//  Signal erzeugt fuer jede verzoegerte Verbindung ein SignalEvent, das den
+//  Parameter des Signals kopiert, und uebergibt es dem SignalDispatcher der
+//  Verbindung. Dieser ruft Deliver() auf und loescht das Ereignis danach.
+//  Wurde die Verbindung inzwischen geloest, tut Deliver() nichts. next steht
+//  dem SignalDispatcher zur Verkettung zur Verfuegung.
+//
+class SignalEvent
+{
+public:
+
+    SignalEvent()
+        : next(nullptr) {}
+
+    virtual ~SignalEvent() {}
+
+    //
+    //  Ruft den Slot mit dem gespeicherten Parameter auf, wenn die
+    //  Verbindung noch besteht.
+    //
+    virtual void Deliver() = 0;
+
+    SignalEvent* next;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Schnittstelle fuer Objekte, die SignalEvents entgegennehmen und in ihrem
+//  eigenen Thread ausfuehren, z.B. Looper.
+//
+//  PostSignalEvent() wird im Thread des aktivierten Signals aufgerufen und
+//  uebernimmt event. Die Funktion muss aus beliebigen Threads aufgerufen
+//  werden koennen und sollte nicht blockieren.
+//
+class SignalDispatcher
+{
+public:
+
+    virtual ~SignalDispatcher() {}
+
+    virtual void PostSignalEvent(SignalEvent* event) = 0;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Zustand einer verzoegerten Verbindung, den das Signal mit allen noch
+//  nicht ausgefuehrten SignalEvents der Verbindung teilt.
+//
+//  Das Signal ruft Post() wie einen gewoehnlichen Slot auf; Post() legt ein
+//  SignalEvent mit einer Kopie des Parameters an und uebergibt es dem
+//  SignalDispatcher. Disconnect() und der Destruktor des Signals markieren
+//  die Verbindung als geloest; Ereignisse, die danach ausgefuehrt werden,
+//  rufen den Slot nicht mehr auf. Das Objekt wird geloescht, wenn das
+//  Signal und alle Ereignisse ihre Referenz freigegeben haben.
+//
+template <class T>
+class SignalLink
+{
+public:
+
+    typedef void (SignalReceiver::*MemberFn)(T);
+
+    SignalLink(void* receiver, MemberFn fn, SignalDispatcher* dispatcher)
+        : m_receiver(receiver), m_fn(fn), m_dispatcher(dispatcher),
+          m_refCount(1), m_connected(true) {}
+
+    void* Receiver() const
+    { return m_receiver; }
+
+    MemberFn Fn() const
+    { return m_fn; }
+
+    bool IsConnected() const
+    { return m_connected.Load(MEMORY_ORDER_ACQUIRE); }
+
+    void Disconnect()
+    { m_connected.Store(false, MEMORY_ORDER_RELEASE); }
+
+    void AddRef()
+    { m_refCount.FetchAdd(1, MEMORY_ORDER_RELAXED); }
+
+    void ReleaseRef()
+    {
+        if (m_refCount.FetchSub(1, MEMORY_ORDER_ACQ_REL) <= 1)
+            delete this;
+    }
+
+    void Post(T arg);
+
+    void Deliver(T arg)
+    {
+        if (IsConnected())
+            (static_cast<SignalReceiver*>(m_receiver)->*m_fn)(arg);
+    }
+
+private:
+
+    SignalLink(const SignalLink&);
+    SignalLink& operator=(const SignalLink&);
+
+    void*               m_receiver;
+    MemberFn            m_fn;
+    SignalDispatcher*   m_dispatcher;
+    Atomic<uint>        m_refCount;
+    Atomic<bool>        m_connected;
+};
+
+//----------------------------------------------------------------------------
+//
+//  SignalEvent, das den Slot einer verzoegerten Verbindung mit einer Kopie
+//  von arg aufruft.
+//
+template <class T>
+class SignalEventImpl: public SignalEvent
+{
+public:
+
+    SignalEventImpl(SignalLink<T>* link, T arg)
+        : m_link(link), m_arg(arg)
+    { m_link->AddRef(); }
+
+    ~SignalEventImpl()
+    { m_link->ReleaseRef(); }
+
+    void Deliver()
+    { m_link->Deliver(m_arg); }
+
+private:
+
+    SignalLink<T>*  m_link;
+    T               m_arg;
+};
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void SignalLink<T>::Post(T arg)
+{
+    m_dispatcher->PostSignalEvent(new SignalEventImpl<T>(this, arg));
+}
+
+//----------------------------------------------------------------------------
+//
+//  Eintrag fuer eine Verbindung zwischen einem Signal und einem Slot.
+//
+//  Das Signal ruft fuer jeden verbundenen Eintrag receiver->*fn auf, ohne
+//  die Art der Verbindung zu unterscheiden. Bei verzoegerten Verbindungen
+//  sind receiver und fn der link und dessen Post(); nur sie haben einen
+//  link und halten eine Referenz darauf.
+//
+//  Da connected atomar ist, kann Disconnect() einen Eintrag loesen,
+//  waehrend eine Aktivierung in einem anderen Thread die Tabelle
+//  durchlaeuft; alle uebrigen Felder werden nur geschrieben, solange der
+//  Eintrag frei ist und noch nie verbunden war, und mit connected
+//  veroeffentlicht. serial ist die Nummer der Verbindung, next_free
+//  verkettet die freien Eintraege fuer Connect(); beide werden nur von
+//  Schreibern gelesen.
+//
+template <class T>
+struct SignalSlot
+{
+    typedef void (SignalReceiver::*MemberFn)(T);
+
+    bool IsConnected() const
+    { return connected.Load(MEMORY_ORDER_RELAXED); }
+
+    Atomic<bool>        connected;
+    uint                serial;
+    void*               receiver;
+    MemberFn            fn;
+    SignalLink<T>*      link;
+    uint                next_free;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Tabelle der Verbindungen eines Signals.
+//
+//  count Eintraege sind veroeffentlicht; Connect() haengt bis capacity
+//  weitere an oder belegt einen der freien Eintraege unterhalb von count.
+//  Ist die Tabelle voll, ersetzt das Signal sie durch eine neue. Die alte
+//  Tabelle wird ueber retired mit den uebrigen ausgemusterten Tabellen
+//  verkettet und erst freigegeben, wenn keine Aktivierung sie mehr
+//  verwenden kann.
+//
+template <class T>
+struct SignalSlotTable
+{
+    uint                    capacity;
+    Atomic<uint>            count;
+    uint                    free;
+    SignalSlotTable<T>*     retired;
+    SignalSlot<T>*          slots;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Die Signal-Klasse dient zur Kommunikation zwischen Objekten.
+//
+//  Signale koennen mit typkompatiblen Elementfunktionen (Slots) "verbunden"
+//  werden. Zwischen Signalen und Slots besteht eine n:n - Beziehung. Wird
+//  ein Signal aktiviert, werden alle verbundenen Slots mit dem Parameter
+//  des Signals aufgerufen.
+//
+//  Die Verbindungen liegen hintereinander in einer SignalSlotTable und
+//  werden beim Aktivieren der Reihe nach mit einem einzigen indirekten
+//  Aufruf je Slot und ohne Verzweigung nach der Art der Verbindung
+//  aufgerufen. Die Indizes der
+//  Verbindungen bleiben bis zu ihrer Loesung gueltig, auch wenn die Tabelle
+//  ersetzt wird.
+//
+//  Die Aktivierung kommt ohne Sperre aus: Sie zaehlt sich im Zaehler der
+//  laufenden Epoche ein, laedt die aktuelle Tabelle und ruft deren
+//  Eintraege auf. Connect() und Disconnect() belegen eine Sperre, die nur
+//  Schreiber untereinander ausschliesst. Ein Eintrag wird nie veraendert,
+//  nachdem er verbunden wurde; Disconnect() setzt nur sein connected
+//  zurueck, und zwar in der aktuellen und in allen ausgemusterten Tabellen.
+//  Ein geloester Eintrag wird erst in der naechsten Tabelle wieder frei.
+//
+//  Ausgemusterte Tabellen sammelt das Signal in m_retired. Ist die
+//  vorige Epoche leer, beginnt es eine neue und schiebt sie nach
+//  m_pending; ist auch diese Epoche beendet, gibt es sie frei. Da neue
+//  Aktivierungen immer in der laufenden Epoche beginnen, wird jede Epoche
+//  irgendwann leer, auch wenn sich Aktivierungen in mehreren Threads
+//  ununterbrochen ueberlappen. Ein Signal darf daher in einem Thread
+//  aktiviert werden, waehrend ein anderer Verbindungen herstellt oder
+//  loest. Ein Slot, dessen Verbindung waehrend einer Aktivierung in einem
+//  anderen Thread geloest wird, kann noch ein letztes Mal aufgerufen
+//  werden.
+//
+//  Slots duerfen Verbindungen desselben Signals herstellen und loesen und
+//  das Signal erneut aktivieren. Eine geloeste Verbindung wird danach nicht
+//  mehr aufgerufen, eine neu hergestellte erst bei der naechsten
+//  Aktivierung. Das Signal selbst darf in einem Slot nicht zerstoert werden
+//  und muss jede Aktivierung in einem anderen Thread ueberdauern.
+//
+//  Mit ConnectQueued() hergestellte Verbindungen rufen den Slot nicht
+//  sofort auf, sondern uebergeben eine Kopie des Parameters an einen
+//  SignalDispatcher, meist den Looper des Empfaengers. Der Slot wird dann
+//  in dessen Thread ausgefuehrt; der aktivierende Thread zahlt nur fuer das
+//  Anlegen des Ereignisses und das Einreihen. Wird die Verbindung geloest
+//  oder das Signal zerstoert, verwerfen die noch nicht ausgefuehrten
+//  Ereignisse den Aufruf (siehe SignalLink). Geschieht das im Thread des
+//  Dispatchers, wird der Slot danach sicher nicht mehr aufgerufen; der
+//  Empfaenger darf also zerstoert werden, nachdem er dort seine
+//  Verbindungen geloest hat.
+//
+template <class T>
+class Signal
+{
+public:
+
+    //
+    //  Erstellt ein neues Signal-Objekt ohne Verbindungen.
+    //
+    Signal()
+        : m_table(nullptr), m_retired(nullptr), m_pending(nullptr),
+          m_epoch(0), m_serial(0), m_live(0) {}
+
+    //
+    //  Loest alle Verbindungen und gibt die Tabellen frei.
+    //
+    ~Signal();
+
+    //
+    //  Aktiviert das Signal. Alle verbundenen Slots werden nacheinander mit
+    //  dem Parameter arg aufgerufen.
+    //
+    void operator()(T arg);
+
+    //
+    //  Verbindet das Signal mit dem Slot fn des Objekts receiver. Wird danach
+    //  das Signal aktiviert, wird receiver::fn() aufgerufen. Die gelieferte
+    //  Kennung kann an Disconnect() uebergeben werden.
+    //
+    template <class Recv>
+    SignalConnection Connect(Recv* receiver, void (Recv::*fn)(T))
+    {
+        SpinLocker locker(m_lock);
+        return Insert(receiver, reinterpret_cast<MemberFn>(fn), nullptr);
+    }
+
+    //
+    //  Verbindet das Signal mit dem Slot fn des Objekts receiver. Wird danach
+    //  das Signal aktiviert, wird receiver::fn() nicht sofort aufgerufen,
+    //  sondern durch dispatcher in dessen Thread.
+    //
+    template <class Recv>
+    SignalConnection ConnectQueued(Recv* receiver, void (Recv::*fn)(T),
+                                   SignalDispatcher* dispatcher)
+    {
+        SignalLink<T>* link = new SignalLink<T>(
+            receiver, reinterpret_cast<MemberFn>(fn), dispatcher);
+        SpinLocker locker(m_lock);
+
+        return Insert(link, reinterpret_cast<MemberFn>(&SignalLink<T>::Post),
+                      link);
+    }
+
+    //
+    //  Loest die Verbindung mit der Kennung connection. Die Funktion liefert
+    //  false, wenn die Verbindung bereits geloest war.
+    //
+    bool Disconnect(const SignalConnection& connection);
+
+    //
+    //  Loest die Verbindung zwischen dem Signal und dem Slot fn des Objekts
+    //  receiver. Wird danach das Signal aktiviert, wird receiver::fn() nicht
+    //  mehr aufgerufen. Im Gegensatz zu Disconnect(connection) muessen dazu
+    //  alle Verbindungen durchsucht werden.
+    //
+    template <class Recv>
+    bool Disconnect(Recv* receiver, void (Recv::*fn)(T));
+
+private:
+
+    typedef typename SignalSlot<T>::MemberFn MemberFn;
+    typedef SignalSlotTable<T> Table;
+
+    static const uint MIN_CAPACITY = 4;
+    static const uint NO_SLOT = ~0u;
+
+    //
+    //  Signale koennen nicht kopiert oder zugewiesen werden.
+    //
+    Signal(const Signal<T>&);
+    Signal<T>& operator=(const Signal&);
+
+    static Table* CreateTable(uint capacity);
+    static void DestroyTable(Table* table);
+
+    SignalConnection Insert(void* receiver, MemberFn fn,
+                            SignalLink<T>* link);
+    void Remove(uint index);
+    Table* ReplaceTable();
+    void Reclaim();
+    static void DestroyTables(Table* table);
+
+    SpinLock        m_lock;
+    Atomic<Table*>  m_table;
+    Atomic<Table*>  m_retired;
+    Atomic<Table*>  m_pending;
+    Atomic<uint>    m_epoch;
+    Atomic<uint>    m_emitting[2];
+    uint            m_serial;
+    uint            m_live;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Verbindet das Signal signal mit dem Slot fn des Objekts receiver. Wird
+//  danach das Signal aktiviert, wird receiver::fn() aufgerufen.
+//
+template <class T, class Recv>
+inline SignalConnection Connect(Signal<T>& signal, Recv* receiver,
+                                void (Recv::*fn)(T))
+{ return signal.Connect(receiver, fn); }
+
+//----------------------------------------------------------------------------
+//
+//  Verbindet das Signal signal mit dem Slot fn des Objekts receiver. Der
+//  Slot wird bei jeder Aktivierung durch dispatcher in dessen Thread
+//  aufgerufen.
+//
+template <class T, class Recv>
+inline SignalConnection ConnectQueued(Signal<T>& signal, Recv* receiver,
+                                      void (Recv::*fn)(T),
+                                      SignalDispatcher* dispatcher)
+{ return signal.ConnectQueued(receiver, fn, dispatcher); }
+
+//----------------------------------------------------------------------------
+//
+//  Loest die Verbindung zwischen dem Signal signal und dem Slot fn des
+//  Objekts receiver. Wird danach das Signal aktiviert, wird receiver::fn()
+//  nicht mehr aufgerufen.
+//
+template <class T, class Recv>
+inline bool Disconnect(Signal<T>& signal, Recv* receiver, void (Recv::*fn)(T))
+{ return signal.Disconnect(receiver, fn); }
+
+//----------------------------------------------------------------------------
+//
+//  Loest die Verbindung mit der Kennung connection.
+//
+template <class T>
+inline bool Disconnect(Signal<T>& signal, const SignalConnection& connection)
+{ return signal.Disconnect(connection); }
+
+//----------------------------------------------------------------------------
+
+template <class T>
+Signal<T>::~Signal()
+{
+    Table* table = m_table.Load(MEMORY_ORDER_RELAXED);
+
+    if (table == nullptr)
+        return;
+
+    uint count = table->count.Load(MEMORY_ORDER_RELAXED);
+
+    for (uint i = 0; i < count; ++i)
+    {
+        const SignalSlot<T>& slot = table->slots[i];
+
+        if (slot.link != nullptr)
+            slot.link->Disconnect();
+    }
+
+    DestroyTable(table);
+    DestroyTables(m_retired.Load(MEMORY_ORDER_RELAXED));
+    DestroyTables(m_pending.Load(MEMORY_ORDER_RELAXED));
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void Signal<T>::operator()(T arg)
+{
+    //  Ein Signal ohne Verbindungen kommt ohne atomare Operation aus. Laeuft
+    //  dabei in einem anderen Thread ein Connect(), ist es gleichgueltig, ob
+    //  dessen Slot schon aufgerufen wird.
+
+    if (m_table.Load(MEMORY_ORDER_RELAXED) == nullptr)
+        return;
+
+    //  Der Zaehler der Epoche wird erhoeht, bevor die Tabelle geladen wird.
+    //  Findet Reclaim() ihn danach gleich 0, verwendet keine Aktivierung
+    //  dieser Epoche mehr eine ausgemusterte Tabelle. Hat inzwischen eine
+    //  neue Epoche begonnen, wird die Aktivierung noch der alten
+    //  zugerechnet; sie laedt aber bereits die neue Tabelle.
+
+    Atomic<uint>& emitting =
+        m_emitting[m_epoch.Load(MEMORY_ORDER_SEQ_CST) & 1];
+
+    emitting.FetchAdd(1, MEMORY_ORDER_SEQ_CST);
+
+    Table* table = m_table.Load(MEMORY_ORDER_SEQ_CST);
+    uint count = table->count.Load(MEMORY_ORDER_ACQUIRE);
+    const SignalSlot<T>* slots = table->slots;
+
+    for (uint i = 0; i < count; ++i)
+    {
+        const SignalSlot<T>& slot = slots[i];
+
+        if (slot.connected.Load(MEMORY_ORDER_ACQUIRE))
+            (static_cast<SignalReceiver*>(slot.receiver)->*slot.fn)(arg);
+    }
+
+    //  Hat ein Schreiber Tabellen ausgemustert, waehrend diese Aktivierung
+    //  lief, beendet die letzte Aktivierung der Epoche sie.
+
+    if (emitting.FetchSub(1, MEMORY_ORDER_SEQ_CST) == 1
+        && (m_retired.Load(MEMORY_ORDER_SEQ_CST) != nullptr
+            || m_pending.Load(MEMORY_ORDER_SEQ_CST) != nullptr))
+    {
+        SpinLocker locker(m_lock);
+        Reclaim();
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+bool Signal<T>::Disconnect(const SignalConnection& connection)
+{
+    SpinLocker locker(m_lock);
+    Table* table = m_table.Load(MEMORY_ORDER_RELAXED);
+
+    if (table == nullptr
+        || connection.index >= table->count.Load(MEMORY_ORDER_RELAXED))
+        return false;
+
+    const SignalSlot<T>& slot = table->slots[connection.index];
+
+    if (!slot.IsConnected() || slot.serial != connection.serial)
+        return false;
+
+    Remove(connection.index);
+    return true;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+template <class Recv>
+bool Signal<T>::Disconnect(Recv* receiver, void (Recv::*fn)(T))
+{
+    MemberFn member_fn = reinterpret_cast<MemberFn>(fn);
+
+    SpinLocker locker(m_lock);
+    Table* table = m_table.Load(MEMORY_ORDER_RELAXED);
+
+    if (table == nullptr)
+        return false;
+
+    uint count = table->count.Load(MEMORY_ORDER_RELAXED);
+
+    for (uint i = 0; i < count; ++i)
+    {
+        const SignalSlot<T>& slot = table->slots[i];
+
+        if (!slot.IsConnected())
+            continue;
+
+        //  Bei verzoegerten Verbindungen stehen Empfaenger und Slot im link.
+
+        bool queued = slot.link != nullptr;
+        void* slot_receiver = queued ? slot.link->Receiver() : slot.receiver;
+        MemberFn slot_fn = queued ? slot.link->Fn() : slot.fn;
+
+        if (slot_receiver == receiver && slot_fn == member_fn)
+        {
+            Remove(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+SignalSlotTable<T>* Signal<T>::CreateTable(uint capacity)
+{
+    Table* table = new Table;
+
+    table->capacity = capacity;
+    table->free = NO_SLOT;
+    table->retired = nullptr;
+    table->slots = new SignalSlot<T>[capacity];
+
+    for (uint i = 0; i < capacity; ++i)
+    {
+        SignalSlot<T>& slot = table->slots[i];
+
+        slot.connected.Store(false, MEMORY_ORDER_RELAXED);
+        slot.serial = 0;
+        slot.receiver = nullptr;
+        slot.link = nullptr;
+    }
+
+    return table;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void Signal<T>::DestroyTable(Table* table)
+{
+    uint count = table->count.Load(MEMORY_ORDER_RELAXED);
+
+    for (uint i = 0; i < count; ++i)
+    {
+        if (table->slots[i].link != nullptr)
+            table->slots[i].link->ReleaseRef();
+    }
+
+    delete[] table->slots;
+    delete table;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+SignalConnection Signal<T>::Insert(void* receiver, MemberFn fn,
+                                   SignalLink<T>* link)
+{
+    Table* table = m_table.Load(MEMORY_ORDER_RELAXED);
+
+    if (table == nullptr)
+        table = ReplaceTable();
+
+    //  Freie Eintraege unterhalb von count werden nur belegt, wenn keine
+    //  Aktivierung laeuft. Eine Aktivierung in einem anderen Thread, die
+    //  gerade beginnt, darf die neue Verbindung sehen; eine laufende im
+    //  selben Thread, deren Slot Connect() aufruft, darf es nicht. Sie hat
+    //  count bereits gelesen und uebersieht angehaengte Eintraege.
+
+    uint count = table->count.Load(MEMORY_ORDER_RELAXED);
+    uint index = table->free;
+
+    if (index != NO_SLOT && m_emitting[0].Load(MEMORY_ORDER_SEQ_CST) == 0
+        && m_emitting[1].Load(MEMORY_ORDER_SEQ_CST) == 0)
+        table->free = table->slots[index].next_free;
+    else if (count < table->capacity)
+        index = count;
+    else
+    {
+        table = ReplaceTable();
+        count = table->count.Load(MEMORY_ORDER_RELAXED);
+        index = count;
+    }
+
+    //  Der Eintrag war in dieser Tabelle noch nie verbunden; eine
+    //  Aktivierung sieht ihn erst, wenn connected gesetzt ist.
+
+    SignalSlot<T>& slot = table->slots[index];
+
+    slot.receiver = receiver;
+    slot.fn = fn;
+    slot.link = link;
+    slot.serial = ++m_serial;
+    slot.connected.Store(true, MEMORY_ORDER_RELEASE);
+
+    if (index == count)
+        table->count.Store(count + 1, MEMORY_ORDER_RELEASE);
+
+    ++m_live;
+    return SignalConnection(index, slot.serial);
+}
+
+//----------------------------------------------------------------------------
+//
+//  Loest die Verbindung an der Position index der aktuellen Tabelle. Der
+//  Eintrag wird auch in den ausgemusterten Tabellen geloest, in denen eine
+//  laufende Aktivierung ihn noch aufrufen koennte.
+//
+template <class T>
+void Signal<T>::Remove(uint index)
+{
+    SignalSlot<T>& slot = m_table.Load(MEMORY_ORDER_RELAXED)->slots[index];
+    uint serial = slot.serial;
+
+    if (slot.link != nullptr)
+        slot.link->Disconnect();
+
+    slot.connected.Store(false, MEMORY_ORDER_RELEASE);
+
+    Table* retired[2] = { m_retired.Load(MEMORY_ORDER_RELAXED),
+                          m_pending.Load(MEMORY_ORDER_RELAXED) };
+
+    for (uint i = 0; i < 2; ++i)
+    {
+        for (Table* table = retired[i]; table != nullptr;
+             table = table->retired)
+        {
+            if (index >= table->count.Load(MEMORY_ORDER_RELAXED))
+                continue;
+
+            SignalSlot<T>& old_slot = table->slots[index];
+
+            if (old_slot.serial == serial)
+                old_slot.connected.Store(false, MEMORY_ORDER_RELEASE);
+        }
+    }
+
+    --m_live;
+}
+
+//----------------------------------------------------------------------------
+//
+//  Ersetzt die aktuelle Tabelle durch eine neue, in der alle verbundenen
+//  Eintraege an ihrer bisherigen Position stehen und alle uebrigen frei
+//  sind. Hinter den bisherigen Eintraegen koennen mehr Verbindungen
+//  angehaengt werden, als bestehen, so dass jede Verbindung im Mittel nur
+//  konstant viele Eintraege kopiert.
+//
+template <class T>
+SignalSlotTable<T>* Signal<T>::ReplaceTable()
+{
+    Table* old_table = m_table.Load(MEMORY_ORDER_RELAXED);
+    uint old_count = old_table != nullptr
+        ? old_table->count.Load(MEMORY_ORDER_RELAXED) : 0;
+
+    uint capacity = old_count + m_live + 1;
+
+    if (capacity < MIN_CAPACITY)
+        capacity = MIN_CAPACITY;
+
+    Table* table = CreateTable(capacity);
+    uint count = 0;
+
+    for (uint i = 0; i < old_count; ++i)
+    {
+        const SignalSlot<T>& old_slot = old_table->slots[i];
+
+        if (!old_slot.IsConnected())
+            continue;
+
+        SignalSlot<T>& slot = table->slots[i];
+
+        slot.receiver = old_slot.receiver;
+        slot.fn = old_slot.fn;
+        slot.link = old_slot.link;
+        slot.serial = old_slot.serial;
+        slot.connected.Store(true, MEMORY_ORDER_RELAXED);
+
+        if (slot.link != nullptr)
+            slot.link->AddRef();
+
+        count = i + 1;
+    }
+
+    for (uint i = count; i > 0; --i)
+    {
+        if (!table->slots[i - 1].IsConnected())
+        {
+            table->slots[i - 1].next_free = table->free;
+            table->free = i - 1;
+        }
+    }
+
+    table->count.Store(count, MEMORY_ORDER_RELAXED);
+    m_table.Store(table, MEMORY_ORDER_SEQ_CST);
+
+    if (old_table != nullptr)
+    {
+        old_table->retired = m_retired.Load(MEMORY_ORDER_RELAXED);
+        m_retired.Store(old_table, MEMORY_ORDER_SEQ_CST);
+        Reclaim();
+    }
+
+    return table;
+}
+
+//----------------------------------------------------------------------------
+//
+//  Gibt die ausgemusterten Tabellen frei, die keine Aktivierung mehr
+//  verwenden kann, und beginnt gegebenenfalls eine neue Epoche. Die Sperre
+//  muss belegt sein.
+//
+//  m_pending enthaelt die Tabellen, die vor Beginn der laufenden Epoche
+//  ausgemustert wurden. Nur Aktivierungen der vorigen Epoche koennen sie
+//  geladen haben; ist deren Zaehler gleich 0, werden sie freigegeben, und
+//  die Tabellen aus m_retired ruecken mit einer neuen Epoche nach. Deren
+//  Zaehler ist der gerade geleerte, so dass Aktivierungen der vorletzten
+//  Epoche nie mit denen der neuen vermischt werden.
+//
+template <class T>
+void Signal<T>::Reclaim()
+{
+    for (;;)
+    {
+        uint epoch = m_epoch.Load(MEMORY_ORDER_RELAXED);
+
+        if (m_emitting[(epoch + 1) & 1].Load(MEMORY_ORDER_SEQ_CST) != 0)
+            return;
+
+        DestroyTables(m_pending.Exchange(nullptr, MEMORY_ORDER_RELAXED));
+
+        Table* retired = m_retired.Exchange(nullptr, MEMORY_ORDER_RELAXED);
+
+        if (retired == nullptr)
+            return;
+
+        m_pending.Store(retired, MEMORY_ORDER_SEQ_CST);
+        m_epoch.Store(epoch + 1, MEMORY_ORDER_SEQ_CST);
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class T>
+void Signal<T>::DestroyTables(Table* table)
+{
+    while (table != nullptr)
+    {
+        Table* next = table->retired;
+        DestroyTable(table);
+        table = next;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,511 @@
+#ifndef support_SkipList_h
+#define support_SkipList_h
+
+#include "support/Collection.h"
+#include "support/Utilities.h"
+
+#include <new>
+
+//----------------------------------------------------------------------------
+//
+//  Template-Klasse fuer eine Folge von Elementen mit schnellem Zugriff ueber
+//  die Position.
+//
+//  Ein Vector greift in konstanter Zeit auf ein Element zu, muss beim
+//  Einfuegen und Entfernen in der Mitte aber alle nachfolgenden Elemente
+//  verschieben. Eine List fuegt in konstanter Zeit ein, findet die Position
+//  aber nur durch Abzaehlen. Eine SkipList erledigt beides in O(log n): Die
+//  Elemente sind wie in einer Liste verkettet, zusaetzlich besitzt jeder
+//  Knoten mit der Wahrscheinlichkeit 1/4 pro Stufe weitere Verweise, die
+//  immer groessere Abschnitte der Liste ueberspringen. Jeder Verweis merkt
+//  sich, wie viele Elemente er ueberspringt, so dass die Suche nach einer
+//  Position auf den oberen Stufen grosse Schritte machen kann.
+//
+//  Wie Vector und List speichert eine SkipList nur Zeiger auf die Elemente.
+//  Das Kopieren und Loeschen der Elemente wird wie bei allen Collections
+//  ueber AutoDelete bzw. den Parameter Ownership (siehe Collection.h)
+//  gesteuert.
+//
+template <class T, class Ownership = DynamicOwnership<T> >
+class SkipList: public Collection<T, Ownership>
+{
+public:
+
+    static const uint   MAX_LEVEL   = 16;
+
+    //
+    //  Erstellt eine leere Liste.
+    //
+    SkipList();
+
+    //
+    //  Entfernt alle Elemente aus der Liste und zerstoert das Objekt. Ist
+    //  AutoDelete auf true gesetzt, werden die Elemente geloescht.
+    //
+    virtual ~SkipList();
+
+    //
+    //  Weist der Liste eine Kopie von list zu. Es werden standardmaessig nur
+    //  die Zeiger auf die Elemente kopiert. Ist die Liste vorher nicht leer,
+    //  werden alle Elemente entfernt und - falls AutoDelete auf true gesetzt
+    //  ist - geloescht. Danach wird AutoDelete auf false gesetzt.
+    //
+    SkipList<T, Ownership>& operator=(const SkipList<T, Ownership>& list);
+
+    //
+    //  Liefert die Anzahl der Elemente der Liste.
+    //
+    uint Count() const
+    { return m_count; }
+
+    //
+    //  Liefert die Position des ersten Elements.
+    //
+    uint Begin() const
+    { return 0; }
+
+    //
+    //  Liefert die Position hinter dem letzten Element.
+    //
+    uint End() const
+    { return m_count; }
+
+    //
+    //  Liefert einen Zeiger auf das Element an der Position pos. pos wird
+    //  nicht auf Gueltigkeit geprueft.
+    //
+    T* operator[](uint pos) const
+    { return NodeAt(pos)->data; }
+
+    //
+    //  Liefert einen Zeiger auf das Element an der Position pos oder Null,
+    //  wenn pos ausserhalb des erlaubten Bereiches liegt.
+    //
+    T* At(uint pos) const
+    { return pos < m_count ? NodeAt(pos)->data : nullptr; }
+
+    //
+    //  Ersetzt das Element an der Position pos durch data. Ist AutoDelete
+    //  auf true gesetzt, wird das alte Element geloescht.
+    //
+    void SetAt(uint pos, T* data);
+
+    //
+    //  Liefert den Index des ersten Elements das gleich data ist, bzw.
+    //  End(), wenn kein solches Element gefunden wird. Die Suche benoetigt
+    //  lineare Zeit.
+    //
+    //  Fuer diese Funktion muss der Operator "==" fuer Elemente des Typs T
+    //  definiert sein.
+    //
+    uint Find(const T& data) const;
+
+    //
+    //  Liefert den Index des ersten Elements, das eine Referenz auf data
+    //  ist, bzw. End(), wenn kein solches Element gefunden wird.
+    //
+    uint FindRef(const T* data) const;
+
+    //
+    //  Entfernt alle Elemente aus der Liste. Ist AutoDelete auf true
+    //  gesetzt, werden die Elemente geloescht.
+    //
+    void Clear();
+
+    //
+    //  Fuegt data an der Position pos ein. Die nachfolgenden Elemente
+    //  ruecken um eine Position nach hinten. Es muss sichergestellt sein,
+    //  dass pos <= Count() ist.
+    //
+    void Insert(T* data, uint pos);
+
+    //
+    //  Haengt data an das Ende der Liste an.
+    //
+    void Append(T* data)
+    { Insert(data, m_count); }
+
+    //
+    //  Entfernt das Element an der Position pos. Ist AutoDelete auf true
+    //  gesetzt, wird das Element geloescht. Es muss sichergestellt sein,
+    //  dass pos < Count() ist.
+    //
+    void Remove(uint pos)
+    { this->DeleteItem(Take(pos)); }
+
+    //
+    //  Entfernt das Element an der Position pos, ohne es zu loeschen, und
+    //  liefert einen Zeiger darauf.
+    //
+    T* Take(uint pos);
+
+    //
+    //  Ruft fuer jedes Element der Liste in der Reihenfolge der Positionen
+    //  die Funktion fn auf. Dies muss eine Funktion mit einem Parameter vom
+    //  Typ T* oder ein entsprechendes Funktionsobjekt sein.
+    //
+    template <class Fn> void DoForEach(Fn fn) const;
+
+private:
+
+    //
+    //  Collections koennen nicht kopiert werden, weil ein ueberschriebenes
+    //  NewItem() nicht von einem Konstruktor aus aufgerufen werden kann.
+    //
+    SkipList(const SkipList<T, Ownership>&);
+
+    struct Node;
+
+    //
+    //  Verweis auf den naechsten Knoten einer Stufe. span ist die Anzahl
+    //  der Positionen, um die der Verweis weiterschaltet. Verweise auf das
+    //  Ende der Liste zaehlen bis hinter das letzte Element.
+    //
+    struct Link
+    {
+        Node*   next;
+        uint    span;
+    };
+
+    //
+    //  Knoten mit level Verweisen. Die Knoten werden mit der passenden
+    //  Anzahl von Verweisen angelegt (siehe NewNode()).
+    //
+    struct Node
+    {
+        T*      data;
+        Link    links[1];
+    };
+
+    static Node* NewNode(uint level, T* data);
+
+    static void FreeNode(Node* node)
+    { ::operator delete(node); }
+
+    //
+    //  Liefert den Knoten an der Position pos.
+    //
+    Node* NodeAt(uint pos) const;
+
+    //
+    //  Sucht fuer jede Stufe den letzten Knoten vor der Position pos und
+    //  speichert ihn in update sowie dessen Rang (Position + 1, der
+    //  Listenkopf hat den Rang 0) in rank.
+    //
+    void FindPredecessors(uint pos, Node** update, uint* rank) const;
+
+    //
+    //  Liefert die Stufe fuer einen neuen Knoten.
+    //
+    uint RandomLevel();
+
+    uint    m_count;
+    uint    m_level;
+    uint    m_random;
+    Node*   m_head;
+};
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+SkipList<T, Ownership>::SkipList()
+    : m_count(0), m_level(1), m_random(2463534242u),
+      m_head(NewNode(MAX_LEVEL, nullptr))
+{}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+SkipList<T, Ownership>::~SkipList()
+{
+    Clear();
+    FreeNode(m_head);
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+SkipList<T, Ownership>&
+SkipList<T, Ownership>::operator=(const SkipList<T, Ownership>& list)
+{
+    if (this != &list)
+    {
+        Clear();
+
+        for (Node* node = list.m_head->links[0].next; node != nullptr;
+             node = node->links[0].next)
+        {
+            Append(node->data);
+        }
+
+        this->AssignedFrom();
+    }
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+void SkipList<T, Ownership>::SetAt(uint pos, T* data)
+{
+    Node* node = NodeAt(pos);
+    T* old_data = node->data;
+
+    node->data = this->NewItem(data);
+    this->DeleteItem(old_data);
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+uint SkipList<T, Ownership>::Find(const T& data) const
+{
+    uint pos = 0;
+
+    for (Node* node = m_head->links[0].next; node != nullptr;
+         node = node->links[0].next, ++pos)
+    {
+        if (*node->data == data)
+            break;
+    }
+
+    return pos;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+uint SkipList<T, Ownership>::FindRef(const T* data) const
+{
+    uint pos = 0;
+
+    for (Node* node = m_head->links[0].next; node != nullptr;
+         node = node->links[0].next, ++pos)
+    {
+        if (node->data == data)
+            break;
+    }
+
+    return pos;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+void SkipList<T, Ownership>::Clear()
+{
+    Node* node = m_head->links[0].next;
+
+    while (node != nullptr)
+    {
+        Node* next = node->links[0].next;
+
+        if (this->DeletesItems())
+            this->DeleteItem(node->data);
+
+        FreeNode(node);
+        node = next;
+    }
+
+    for (uint i = 0; i < MAX_LEVEL; ++i)
+    {
+        m_head->links[i].next = nullptr;
+        m_head->links[i].span = 0;
+    }
+
+    m_count = 0;
+    m_level = 1;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+void SkipList<T, Ownership>::Insert(T* data, uint pos)
+{
+    Node* update[MAX_LEVEL];
+    uint rank[MAX_LEVEL];
+
+    FindPredecessors(pos, update, rank);
+
+    uint level = RandomLevel();
+
+    if (level > m_level)
+    {
+        for (uint i = m_level; i < level; ++i)
+        {
+            update[i] = m_head;
+            rank[i] = 0;
+            m_head->links[i].span = m_count;
+        }
+
+        m_level = level;
+    }
+
+    Node* node = NewNode(level, this->NewItem(data));
+
+    for (uint i = 0; i < level; ++i)
+    {
+        Link& prev = update[i]->links[i];
+        uint offset = pos - rank[i];
+
+        node->links[i].next = prev.next;
+        node->links[i].span = prev.span - offset;
+
+        prev.next = node;
+        prev.span = offset + 1;
+    }
+
+    for (uint i = level; i < m_level; ++i)
+        ++update[i]->links[i].span;
+
+    ++m_count;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+T* SkipList<T, Ownership>::Take(uint pos)
+{
+    Node* update[MAX_LEVEL];
+    uint rank[MAX_LEVEL];
+
+    FindPredecessors(pos, update, rank);
+
+    Node* node = update[0]->links[0].next;
+
+    for (uint i = 0; i < m_level; ++i)
+    {
+        Link& prev = update[i]->links[i];
+
+        if (prev.next == node)
+        {
+            prev.span += node->links[i].span - 1;
+            prev.next = node->links[i].next;
+        }
+        else
+        {
+            --prev.span;
+        }
+    }
+
+    while (m_level > 1 && m_head->links[m_level - 1].next == nullptr)
+        --m_level;
+
+    T* data = node->data;
+    FreeNode(node);
+    --m_count;
+
+    return data;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+template <class Fn>
+void SkipList<T, Ownership>::DoForEach(Fn fn) const
+{
+    for (Node* node = m_head->links[0].next; node != nullptr;
+         node = node->links[0].next)
+    {
+        fn(node->data);
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+typename SkipList<T, Ownership>::Node*
+SkipList<T, Ownership>::NewNode(uint level, T* data)
+{
+    Node* node = static_cast<Node*>(
+        ::operator new(sizeof(Node) + (level - 1) * sizeof(Link)));
+
+    node->data = data;
+
+    for (uint i = 0; i < level; ++i)
+    {
+        node->links[i].next = nullptr;
+        node->links[i].span = 0;
+    }
+
+    return node;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+typename SkipList<T, Ownership>::Node*
+SkipList<T, Ownership>::NodeAt(uint pos) const
+{
+    Node* node = m_head;
+    uint rank = 0;
+
+    for (uint i = m_level; i-- > 0;)
+    {
+        while (node->links[i].next != nullptr
+               && rank + node->links[i].span <= pos + 1)
+        {
+            rank += node->links[i].span;
+            node = node->links[i].next;
+        }
+
+        if (rank == pos + 1)
+            break;
+    }
+
+    return node;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+void SkipList<T, Ownership>::FindPredecessors(uint pos, Node** update,
+                                              uint* rank) const
+{
+    Node* node = m_head;
+    uint traversed = 0;
+
+    for (uint i = m_level; i-- > 0;)
+    {
+        while (node->links[i].next != nullptr
+               && traversed + node->links[i].span <= pos)
+        {
+            traversed += node->links[i].span;
+            node = node->links[i].next;
+        }
+
+        update[i] = node;
+        rank[i] = traversed;
+    }
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+uint SkipList<T, Ownership>::RandomLevel()
+{
+    uint level = 1;
+
+    for (;;)
+    {
+        //
+        //  Xorshift-Generator; fuer die Verteilung der Stufen genuegt
+        //  diese einfache Folge.
+        //
+        m_random ^= m_random << 13;
+        m_random ^= m_random >> 17;
+        m_random ^= m_random << 5;
+
+        if (level >= MAX_LEVEL || (m_random & 3) != 0)
+            break;
+
+        ++level;
+    }
+
+    return level;
+}
+
+//----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef support_SmallVector_h
+#define support_SmallVector_h
+
+#include "support/Utilities.h"
+#include "support/Vector.h"
+
+//----------------------------------------------------------------------------
+//
+//  Vektor mit internem Speicher fuer N Elemente.
+//
+//  Die meisten Vektoren enthalten nur wenige Elemente. Ein SmallVector
+//  speichert die ersten N Zeiger direkt im Objekt und reserviert erst dann
+//  Speicher auf dem Heap, wenn mehr als N Elemente eingefuegt werden. Fuer
+//  kleine Vektoren entfaellt damit die Speicheranforderung fuer das
+//  Zeiger-Array vollstaendig. Schrumpft der Vektor mit Shrink() wieder auf
+//  hoechstens N Elemente, wird der interne Speicher erneut verwendet.
+//
+//  Ansonsten verhaelt sich ein SmallVector genau wie ein Vector und kann
+//  ueberall dort verwendet werden, wo ein Vector erwartet wird.
+//
+template <class T, uint N, class Ownership = DynamicOwnership<T> >
+class SmallVector: public Vector<T, Ownership>
+{
+public:
+
+    //
+    //  Erstellt einen leeren Vektor. Ist capacity groesser als N, wird sofort
+    //  Speicher fuer capacity Elemente reserviert.
+    //
+    SmallVector(uint capacity = N)
+        : Vector<T, Ownership>(m_inline, N, capacity) {}
+
+    //
+    //  Weist dem Vektor eine Kopie von vector zu (siehe Vector::operator=).
+    //
+    SmallVector<T, N, Ownership>& operator=(
+        const Vector<T, Ownership>& vector)
+    { Vector<T, Ownership>::operator=(vector); return *this; }
+
+    SmallVector<T, N, Ownership>& operator=(
+        const SmallVector<T, N, Ownership>& vector)
+    { Vector<T, Ownership>::operator=(vector); return *this; }
+
+private:
+
+    //
+    //  Collections koennen nicht kopiert werden, weil ein ueberschriebenes
+    //  NewItem() nicht von einem Konstruktor aus aufgerufen werden kann.
+    //
+    SmallVector(const SmallVector<T, N, Ownership>&);
+
+    T* m_inline[N];
+};
+
+//----------------------------------------------------------------------------
+
+#endif
@@ -1,8 +1,8 @@
+#include "support/NumberParse.h"
 #include "support/String.h"
 
-//----------------------------------------------------------------------------
+#include <cctype>
 
-char _string_buffer[256];
 
 //----------------------------------------------------------------------------
 
@@ -10,33 +10,51 @@ const String String::Empty = String(0, "");
 
 //----------------------------------------------------------------------------
 
-String String::Concat(const char* str1, uint len1,
-                      const char* str2, uint len2)
+String String::FromBuffer(char* data, uint capacity)
 {
-    uint new_length = len1 + len2;
-    String new_string(new_length);
-    char* buf = new_string.m_body->data;
+    String str(StringRef(data, strnlen(data, capacity)));
 
-    strncpy(buf, str1, len1);
-    strncpy(buf + len1, str2, len2);
-    new_string.m_body->length = new_length;
+    delete[] data;
+    return str;
+}
 
-    return new_string;
+//----------------------------------------------------------------------------
+
+String::String(uint capacity, const char* str)
+{
+    if (capacity <= INLINE_CAPACITY)
+        SetInline(str, strnlen(str, capacity));
+    else
+        SetBody(StringBody::Create(capacity, str));
 }
 
 //----------------------------------------------------------------------------
 
 String& String::Append(const char* str, uint len)
 {
-    uint new_length = m_body->length + len;
+    uint length = Length();
+    uint new_length = length + len;
+
+    //  str kann auf die eigene Zeichenkette verweisen und wird deshalb
+    //  kopiert, bevor der bisherige Speicher freigegeben wird. Ein
+    //  gemeinsamer StringBody wird dabei gleich mit passender Kapazitaet
+    //  kopiert; Single() wuerde nur Platz fuer die bisherige Laenge
+    //  reservieren.
 
-    if (new_length > m_body->capacity)
-        AssignBody(new StringBody(new_length, m_body->data));
+    if (new_length > Capacity() || (!IsInline() && m_body->IsShared()))
+    {
+        StringBody* body = StringBody::Create(
+            StringBody::GrowCapacity(Capacity(), new_length), CStr());
+        memcpy(body->data + length, str, len);
+        AssignBody(body);
+    }
     else
+    {
         Single();
+        memmove(Data() + length, str, len);
+    }
 
-    strncpy(m_body->data + m_body->length, str, len);
-    m_body->length = new_length;
+    SetLength(new_length);
 
     return *this;
 }
@@ -45,10 +63,20 @@ String& String::Append(const char* str, uint len)
 
 void String::Shrink()
 {
-    if (m_body->capacity == m_body->length)
+    if (IsInline())
         return;
 
-    AssignBody(new StringBody(m_body->length, m_body->data));
+    StringBody* body = m_body;
+
+    if (body->length <= INLINE_CAPACITY)
+    {
+        SetInline(body->data, body->length);
+        body->ReleaseRef();
+    }
+    else if (body->capacity != body->length)
+    {
+        AssignBody(StringBody::Create(body->length, body->data));
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -57,8 +85,8 @@ String& String::operator=(const String& str)
 {
     if (this != &str)
     {
-        AssignBody(str.m_body);
-        m_body->AddRef();
+        Release();
+        Copy(str);
     }
 
     return *this;
@@ -68,55 +96,86 @@ String& String::operator=(const String& str)
 
 String& String::operator=(const char* str)
 {
-    AssignBody(new StringBody(str));
+    //  str kann auf die eigene Zeichenkette verweisen und wird deshalb
+    //  kopiert, bevor der bisherige Speicher freigegeben wird.
+
+    uint length = strlen(str);
+
+    if (length <= INLINE_CAPACITY)
+    {
+        StringBody* body = IsInline() ? nullptr : m_body;
+        SetInline(str, length);
+
+        if (body != nullptr)
+            body->ReleaseRef();
+    }
+    else
+    {
+        AssignBody(StringBody::Create(length, str));
+    }
+
     return *this;
 }
 
 //----------------------------------------------------------------------------
 
-String String::Left(uint count) const
+void String::Reserve(uint size)
 {
-    String new_str(count);
+    if (size > Capacity())
+        AssignBody(StringBody::Create(size, CStr()));
+}
 
-    strncpy(new_str.m_body->data, m_body->data, count);
-    new_str.m_body->data[count] = '\0';
-    new_str.m_body->length = count;
+//----------------------------------------------------------------------------
+
+int String::ToInt() const
+{
+    int value = 0;
+    ParseInteger(SkipPrefix(CStr()), CStr() + Length(), value);
 
-    return new_str;
+    return value;
 }
 
 //----------------------------------------------------------------------------
 
-String String::Right(uint count) const
+long String::ToLong() const
 {
-    String new_str(count);
+    long value = 0;
+    ParseInteger(SkipPrefix(CStr()), CStr() + Length(), value);
 
-    strncpy(new_str.m_body->data, &m_body->data[m_body->length - count], count);
-    new_str.m_body->data[count] = '\0';
-    new_str.m_body->length = count;
-
-    return new_str;
+    return value;
 }
 
 //----------------------------------------------------------------------------
 
-String String::Mid(uint first, uint count) const
+float String::ToFloat() const
 {
-    String new_str(count);
+    float value = 0.0f;
+    ParseFloat(SkipPrefix(CStr()), CStr() + Length(), value);
 
-    strncpy(new_str.m_body->data, &m_body->data[first], count);
-    new_str.m_body->data[count] = 0;
-    new_str.m_body->length = count;
+    return value;
+}
 
-    return new_str;
+//----------------------------------------------------------------------------
+
+double String::ToDouble() const
+{
+    double value = 0.0;
+    ParseDouble(SkipPrefix(CStr()), CStr() + Length(), value);
+
+    return value;
 }
 
 //----------------------------------------------------------------------------
 
-void String::Reserve(uint size)
+const char* String::SkipPrefix(const char* str)
 {
-    if (size > m_body->capacity)
-        AssignBody(new StringBody(size, m_body->data));
+    while (isspace((uchar) *str))
+        ++str;
+
+    if (str[0] == '+' && str[1] != '-')
+        ++str;
+
+    return str;
 }
 
 //----------------------------------------------------------------------------
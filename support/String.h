@@ -2,7 +2,9 @@
 #define support_String_h
 
 #include "support/Hash.h"
+#include "support/NumberFormat.h"
 #include "support/StringBody.h"
+#include "support/StringRef.h"
 #include "support/Utilities.h"
 
 #include <cstdlib>
@@ -29,25 +31,40 @@
 //  explizit eine einzelne Kopie eines Strings zu erzeugen, kann die Funktion
 //  Single() aufgerufen werden.
 //
+//  Kurze Zeichenketten mit bis zu INLINE_CAPACITY Zeichen werden direkt im
+//  String-Objekt gespeichert. Fuer sie wird kein StringBody und damit kein
+//  Speicher auf dem Heap angelegt; Kopien werden sofort vollstaendig
+//  erstellt. Erst wenn die Zeichenkette laenger wird oder mehr Speicher
+//  reserviert werden soll, wechselt der String zu einem gemeinsam
+//  verwendbaren StringBody.
+//
 class String
 {
 public:
 
+    static const uint   INLINE_CAPACITY = 15;
+
     static const String Empty;
 
     //
-    //  Erzeugt einen String und weist ihm den Speicherbereich data zu. data
-    //  muss ein mit new reserviertes Array mindestens der Groesse capacity
-    //  sein.
+    //  Erzeugt einen String aus der Zeichenkette im Speicherbereich data und
+    //  gibt data anschliessend frei. data muss ein mit new reserviertes
+    //  Array mindestens der Groesse capacity sein; ist es nicht mit einem
+    //  Nullzeichen abgeschlossen, werden capacity Zeichen uebernommen.
     //
-    static String FromBuffer(char* data, uint capacity)
-    { return String(new StringBody(data, capacity)); }
+    static String FromBuffer(char* data, uint capacity);
 
     //
     //  Erzeugt einen String und weist ihm die Zeichenkette str zu.
     //
     String(const char* str = "")
-        : m_body(new StringBody(str)) {}
+    { Init(str, strlen(str)); }
+
+    //
+    //  Erzeugt einen String mit einer Kopie der Zeichenfolge str.
+    //
+    String(const StringRef& str)
+    { Init(str.Data(), str.Length()); }
 
     //
     //  Erzeugt einen String, der Platz fuer capacity Zeichen hat, und
@@ -55,27 +72,32 @@ public:
     //  Speicherzuweisungen vermieden werden, wenn im voraus eine maximale
     //  Laenge bekannt ist.
     //
-    explicit String(uint capacity, const char* str = "")
-        : m_body(new StringBody(capacity, str)) {}
+    explicit String(uint capacity, const char* str = "");
 
     //
     //  Erzeugt eine Kopie des Strings str.
     //
     String(const String& str)
-        : m_body(str.m_body)
-    { m_body->AddRef(); }
+    { Copy(str); }
 
     //
     //  Entfernt den String und gibt den reservierten Speicher frei.
     //
     ~String()
-    { m_body->ReleaseRef(); }
+    { Release(); }
 
     //
     //  Liefert den String als Zeichenkette zurueck.
     //
     const char* CStr() const
-    { return m_body->data; }
+    { return IsInline() ? m_inline : m_body->data; }
+
+    //
+    //  Liefert einen Verweis auf die Zeichenkette des Strings. Der Verweis
+    //  ist nur gueltig, bis der String veraendert oder zerstoert wird.
+    //
+    operator StringRef() const
+    { return StringRef(CStr(), Length()); }
 
     //
     //  Der Index-Operator liefert Schreibzugriff auf einzelne Zeichen des
@@ -83,19 +105,19 @@ public:
     //  wird, so wird zunaechst eine eigene Kopie erzeugt.
     //
     char& operator[](uint index)
-    { Single(); return m_body->data[index]; }
+    { Single(); return Data()[index]; }
 
     //
     //  Liefert Lesezugriff auf einzelne Zeichen des Strings.
     //
     const char& operator[](uint index) const
-    { return m_body->data[index]; }
+    { return CStr()[index]; }
 
     //
     //  Haengt an den String die Zeichen des Strings str an.
     //
     String& operator+=(const String& str)
-    { return Append(str.m_body->data, str.m_body->length); }
+    { return Append(str.CStr(), str.Length()); }
 
     //
     //  Haengt an den String die Zeichen des Strings str an.
@@ -103,6 +125,12 @@ public:
     String& operator+=(const char* str)
     { return Append(str, strlen(str)); }
 
+    //
+    //  Haengt an den String die Zeichenfolge str an.
+    //
+    String& operator+=(const StringRef& str)
+    { return Append(str.Data(), str.Length()); }
+
     //
     //  Weist dem String die Zeichenkette des Strings str zu.
     //
@@ -114,22 +142,36 @@ public:
     String& operator=(const char* str);
 
     //
-    //  Erzeugt einen neuen String mit den ersten count Zeichen des Strings,
-    //  fuer den de Funktion aufgerufen wurde.
+    //  Erzeugt einen neuen String mit den ersten bzw. letzten count Zeichen
+    //  des Strings.
     //
-    String Left(uint count) const;
+    String Left(uint count) const
+    { return String(LeftRef(count)); }
+
+    String Right(uint count) const
+    { return String(RightRef(count)); }
 
     //
-    //  Erzeugt einen neuen String mit den letzten count Zeichen des Strings,
-    //  fuer den die Funktion aufgerufen wurde.
+    //  Erzeugt einen neuen String mit hoechstens count Zeichen ab der
+    //  Position first (von 0 an gerechnet).
     //
-    String Right(uint count) const;
+    String Mid(uint first, uint count) const
+    { return String(MidRef(first, count)); }
 
     //
-    //  Erzeugt einen String mit einer Kopie der ersten count Zeichen ab der
-    //  Position first (von 0 an gerechnet).
+    //  Wie Left(), Right() und Mid(), liefern aber nur einen Verweis in den
+    //  String, ohne die Zeichen zu kopieren. Der Verweis ist nur gueltig,
+    //  bis der String veraendert oder zerstoert wird; auf einen temporaeren
+    //  String darf er deshalb nicht aufbewahrt werden.
     //
-    String Mid(uint first, uint count) const;
+    StringRef LeftRef(uint count) const
+    { return StringRef(*this).Left(count); }
+
+    StringRef RightRef(uint count) const
+    { return StringRef(*this).Right(count); }
+
+    StringRef MidRef(uint first, uint count) const
+    { return StringRef(*this).Mid(first, count); }
 
     //
     //  Wenn mehr Speicher als notwendig reserviert ist, wird der Speicher
@@ -148,91 +190,321 @@ public:
     //  Liefert die Laenge des Strings in Zeichen.
     //
     uint Length() const
-    { return m_body->length; }
+    {
+        return IsInline()
+            ? INLINE_CAPACITY - (uchar) m_inline[INLINE_CAPACITY]
+            : m_body->length;
+    }
 
     //
-    //  Liefern den im String dargestellten Wert zurueck.
+    //  Liefert den Hashwert der Zeichenkette. Er stimmt mit dem Wert von
+    //  HashBuffer(CStr(), Length()) ueberein, wird fuer laengere Strings
+    //  aber nur einmal berechnet und im StringBody gespeichert.
     //
-    int ToInt() const
-    { return atoi(CStr()); }
-
-    long ToLong() const
-    { return atol(CStr()); }
-
-    float ToFloat() const
-    { return (float) atof(CStr()); }
+    uint Hash() const
+    { return IsInline() ? HashBuffer(m_inline, Length()) : m_body->Hash(); }
 
-    double ToDouble() const
-    { return atof(CStr()); }
+    //
+    //  Liefern den im String dargestellten Wert zurueck. Wie bei atoi()
+    //  werden fuehrende Leerzeichen und ein '+' uebersprungen, und Zeichen
+    //  nach der Zahl werden ignoriert. Kann keine Zahl gelesen werden,
+    //  liefern die Funktionen 0; Fehler koennen mit ParseInteger() usw.
+    //  ausgewertet werden. Das eingestellte Locale wird nicht beachtet.
+    //
+    int ToInt() const;
+    long ToLong() const;
+    float ToFloat() const;
+    double ToDouble() const;
 
 private:
 
+    //
+    //  Markierung im letzten Byte von m_inline, wenn der String einen
+    //  StringBody verwendet. Bei direkt gespeicherten Zeichenketten steht
+    //  dort INLINE_CAPACITY - Length(), bei voller Ausnutzung also das
+    //  abschliessende Nullzeichen.
+    //
+    static const uchar  BODY_TAG = 0xff;
+
     //
     //  Erstellt einen String durch direkte Uebernahmen von body. Diese
     //  Funktion erhoeht nicht den Referenzzaehler von body.
     //
     String(StringBody* body)
-        : m_body(body) {}
+    { SetBody(body); }
+
+    //
+    //  Liefert true, wenn die Zeichenkette direkt im String-Objekt steht.
+    //
+    bool IsInline() const
+    { return (uchar) m_inline[INLINE_CAPACITY] != BODY_TAG; }
+
+    //
+    //  Liefert die Anzahl der Zeichen, die ohne neue Speicheranforderung
+    //  aufgenommen werden koennen.
+    //
+    uint Capacity() const
+    { return IsInline() ? INLINE_CAPACITY : m_body->capacity; }
+
+    //
+    //  Liefert Schreibzugriff auf die Zeichenkette. Single() muss vorher
+    //  aufgerufen worden sein.
+    //
+    char* Data()
+    { return IsInline() ? m_inline : m_body->data; }
+
+    //
+    //  Setzt die Laenge der Zeichenkette und schliesst sie mit einem
+    //  Nullzeichen ab. length darf Capacity() nicht ueberschreiten.
+    //
+    void SetLength(uint length)
+    {
+        if (IsInline())
+        {
+            m_inline[length] = '\0';
+            m_inline[INLINE_CAPACITY] = char(INLINE_CAPACITY - length);
+        }
+        else
+        {
+            m_body->data[length] = '\0';
+            m_body->length = length;
+        }
+    }
+
+    //
+    //  Initialisiert den String mit den ersten length Zeichen von str. Der
+    //  bisherige Inhalt wird nicht freigegeben.
+    //
+    void Init(const char* str, uint length)
+    {
+        if (length <= INLINE_CAPACITY)
+            SetInline(str, length);
+        else
+            SetBody(StringBody::Create(length, str));
+    }
+
+    //
+    //  Speichert die ersten length Zeichen von str direkt im String-Objekt.
+    //  str darf in m_inline liegen. Der bisherige Inhalt wird nicht
+    //  freigegeben.
+    //
+    void SetInline(const char* str, uint length)
+    {
+        memmove(m_inline, str, length);
+        m_inline[length] = '\0';
+        m_inline[INLINE_CAPACITY] = char(INLINE_CAPACITY - length);
+    }
+
+    //
+    //  Uebernimmt body, ohne den Referenzzaehler zu erhoehen. Der bisherige
+    //  Inhalt wird nicht freigegeben.
+    //
+    void SetBody(StringBody* body)
+    {
+        m_body = body;
+        m_inline[INLINE_CAPACITY] = char(BODY_TAG);
+    }
+
+    //
+    //  Uebernimmt den Inhalt von str. Verwendet str einen StringBody, wird
+    //  dessen Referenzzaehler erhoeht. Der bisherige Inhalt wird nicht
+    //  freigegeben.
+    //
+    void Copy(const String& str)
+    {
+        memcpy(m_inline, str.m_inline, sizeof(m_inline));
+
+        if (!str.IsInline())
+            m_body->AddRef();
+    }
+
+    //
+    //  Gibt die Referenz auf den StringBody frei, falls der String einen
+    //  verwendet.
+    //
+    void Release()
+    {
+        if (!IsInline())
+            m_body->ReleaseRef();
+    }
 
     //
     //  Erstellt eine eigene Kopie der Zeichenkette des Strings. Dadurch wird
     //  garantiert, dass kein anderer String die Zeichenkette referenziert.
+    //  Die Funktion wird vor jeder Aenderung der Zeichenkette aufgerufen und
+    //  verwirft deshalb auch den gespeicherten Hashwert.
+    //
+    //  Die Referenz auf den gemeinsamen StringBody wird erst nach dem
+    //  Kopieren freigegeben: Gibt ein anderer Thread gleichzeitig seine
+    //  Referenz frei, koennte der StringBody sonst schon geloescht sein.
     //
     void Single()
     {
-        if (m_body->refCount > 1)
+        if (IsInline())
+            return;
+
+        if (m_body->IsShared())
         {
+            StringBody* body = StringBody::Create(m_body->length,
+                                                  m_body->data);
             m_body->ReleaseRef();
-            m_body = new StringBody(m_body->length, m_body->data);
+            m_body = body;
+        }
+        else
+        {
+            m_body->ResetHash();
         }
     }
 
     //
-    //  Gibt die Referenz auf den aktuell verwalteten StringBody frei und
-    //  uebernimmt body. Diese Funktion erhoeht nicht den Referenzzaehler von
-    //  body.
+    //  Gibt die aktuell verwaltete Zeichenkette frei und uebernimmt body.
+    //  Diese Funktion erhoeht nicht den Referenzzaehler von body.
     //
     void AssignBody(StringBody* body)
     {
-        m_body->ReleaseRef();
-        m_body = body;
+        Release();
+        SetBody(body);
     }
 
-    StringBody* m_body;
-
-    static String Concat(const char* str1, uint len1,
-                         const char* str2, uint len2);
+    union
+    {
+        StringBody* m_body;
+        char        m_inline[INLINE_CAPACITY + 1];
+    };
 
     String& Append(const char* str, uint len);
 
-    friend String operator+(const String& str1, const String& str2);
-    friend String operator+(const String& str1, const char* str2);
-    friend String operator+(const char* str1, const String& str2);
+    //
+    //  Ueberspringt wie atoi() fuehrende Leerzeichen und ein '+'.
+    //
+    static const char* SkipPrefix(const char* str);
+
+    friend class StringBuilder;
+    template <class L, class R> friend class StringSum;
 };
 
+
 //----------------------------------------------------------------------------
+//
+//  Ergebnis einer Verknuepfung von Zeichenfolgen mit operator+.
+//
+//  Ein StringSum haelt nur Verweise auf die verknuepften Zeichenfolgen und
+//  deren Gesamtlaenge. Erst bei der Umwandlung in einen String wird
+//  einmal Speicher fuer das vollstaendige Ergebnis reserviert, so dass
+//  a + b + c + d keine Zwischenergebnisse anlegt. L und R sind StringRef
+//  oder wiederum StringSum. Die Operanden muessen gueltig bleiben, bis das
+//  Ergebnis umgewandelt ist; ein StringSum sollte deshalb nicht
+//  gespeichert werden.
+//
+//  Da operator+ keinen String liefert, wird das Ergebnis nicht automatisch
+//  in einen StringRef umgewandelt (dazu waeren zwei benutzerdefinierte
+//  Umwandlungen noetig). Fuer solche Faelle gibt es Str() und CStr().
+//
+template <class L, class R>
+class StringSum
+{
+public:
+
+    StringSum(const L& left, const R& right)
+        : m_left(left),
+          m_right(right),
+          m_length(left.Length() + right.Length()) {}
+
+    //
+    //  Liefert die Laenge des Ergebnisses.
+    //
+    uint Length() const
+    { return m_length; }
 
-extern char _string_buffer[256];
+    //
+    //  Kopiert das Ergebnis ohne abschliessendes Nullzeichen nach dest und
+    //  liefert einen Zeiger hinter das letzte kopierte Zeichen.
+    //
+    char* CopyTo(char* dest) const
+    { return CopyPart(CopyPart(dest, m_left), m_right); }
+
+    //
+    //  Erzeugt einen String mit dem Ergebnis.
+    //
+    String Str() const
+    {
+        String str(m_length);
+
+        CopyTo(str.Data());
+        str.SetLength(m_length);
+
+        return str;
+    }
+
+    operator String() const
+    { return Str(); }
+
+    //
+    //  Liefert das Ergebnis als nullterminierte Zeichenkette. Das Ergebnis
+    //  wird dazu im StringSum gespeichert; der Zeiger bleibt nur gueltig,
+    //  solange das Objekt existiert, bei (a + b).CStr() also bis zum Ende
+    //  des Ausdrucks.
+    //
+    const char* CStr() const
+    {
+        m_result = Str();
+        return m_result.CStr();
+    }
+
+private:
+
+    static char* CopyPart(char* dest, const StringRef& str)
+    {
+        memcpy(dest, str.Data(), str.Length());
+        return dest + str.Length();
+    }
+
+    template <class L2, class R2>
+    static char* CopyPart(char* dest, const StringSum<L2, R2>& sum)
+    { return sum.CopyTo(dest); }
+
+    L               m_left;
+    R               m_right;
+    uint            m_length;
+    mutable String  m_result;
+};
 
 //----------------------------------------------------------------------------
 //
-//  Verknuepft zwei Strings zu einem neuen String.
+//  Verknuepft zwei Zeichenfolgen. Die Operanden koennen Strings,
+//  Zeichenketten, StringRefs oder Ergebnisse weiterer Verknuepfungen sein.
+//  Das Ergebnis wird bei der Zuweisung an einen String erzeugt.
 //
-inline String operator+(const String& str1, const String& str2)
-{ return String::Concat(str1.CStr(), str1.Length(), str2.CStr(), str2.Length()); }
+inline StringSum<StringRef, StringRef>
+operator+(const StringRef& str1, const StringRef& str2)
+{ return StringSum<StringRef, StringRef>(str1, str2); }
 
-inline String operator+(const String& str1, const char* str2)
-{ return String::Concat(str1.CStr(), str1.Length(), str2, strlen(str2)); }
+template <class L, class R>
+inline StringSum<StringSum<L, R>, StringRef>
+operator+(const StringSum<L, R>& str1, const StringRef& str2)
+{ return StringSum<StringSum<L, R>, StringRef>(str1, str2); }
 
-inline String operator+(const char* str1, const String& str2)
-{ return String::Concat(str1, strlen(str1), str2.CStr(), str2.Length()); }
+template <class L, class R>
+inline StringSum<StringRef, StringSum<L, R> >
+operator+(const StringRef& str1, const StringSum<L, R>& str2)
+{ return StringSum<StringRef, StringSum<L, R> >(str1, str2); }
+
+template <class L1, class R1, class L2, class R2>
+inline StringSum<StringSum<L1, R1>, StringSum<L2, R2> >
+operator+(const StringSum<L1, R1>& str1, const StringSum<L2, R2>& str2)
+{ return StringSum<StringSum<L1, R1>, StringSum<L2, R2> >(str1, str2); }
 
 //----------------------------------------------------------------------------
 //
 //  Testet zwei Strings auf Gleichheit.
 //
 inline bool operator==(const String& str1, const String& str2)
-{ return strcmp(str1.CStr(), str2.CStr()) == 0; }
+{
+    uint length = str1.Length();
+
+    return length == str2.Length()
+        && memcmp(str1.CStr(), str2.CStr(), length) == 0;
+}
 
 inline bool operator==(const char* str1, const String& str2)
 { return strcmp(str1, str2.CStr()) == 0; }
@@ -240,6 +512,12 @@ inline bool operator==(const char* str1, const String& str2)
 inline bool operator==(const String& str1, const char* str2)
 { return strcmp(str1.CStr(), str2) == 0; }
 
+inline bool operator==(const StringRef& str1, const String& str2)
+{ return str1 == StringRef(str2.CStr(), str2.Length()); }
+
+inline bool operator==(const String& str1, const StringRef& str2)
+{ return StringRef(str1.CStr(), str1.Length()) == str2; }
+
 //----------------------------------------------------------------------------
 //
 //  Liefert true, wenn str1 (alphanumerisch) kleiner ist als str2,
@@ -256,41 +534,57 @@ inline bool operator<(const String& str1, const char* str2)
 
 //----------------------------------------------------------------------------
 //
-//  Erzeugt einen String aus einem numerischen Wert.
+//  Erzeugt einen String aus einem numerischen Wert. Gleitkommazahlen werden
+//  auf digits signifikante Stellen gerundet; ist digits gleich 0, wird eine
+//  Darstellung erzeugt, die beim Einlesen exakt wieder value ergibt (siehe
+//  FormatDouble()). Die meisten Zahlen passen in einen String ohne eigenen
+//  Speicher.
 //
 inline String ToString(int value)
 {
-    _itoa(value, _string_buffer, 10);
-    return String(_string_buffer);
+    char buffer[NUMBER_BUFFER_SIZE];
+    return String(StringRef(buffer, FormatInteger(buffer, value)));
 }
 
 inline String ToString(long value)
 {
-    _ltoa(value, _string_buffer, 10);
-    return String(_string_buffer);
+    char buffer[NUMBER_BUFFER_SIZE];
+    return String(StringRef(buffer, FormatInteger(buffer, value)));
 }
 
-inline String ToString(float value, int digits = 4)
+inline String ToString(float value, int digits = DEFAULT_FLOAT_DIGITS)
 {
-    _gcvt(value, digits, _string_buffer);
-    return String(_string_buffer);
+    char buffer[NUMBER_BUFFER_SIZE];
+    return String(StringRef(buffer, FormatFloat(buffer, value, digits)));
 }
 
-inline String ToString(double value, int digits = 4)
+inline String ToString(double value, int digits = DEFAULT_FLOAT_DIGITS)
 {
-    _gcvt(value, digits, _string_buffer);
-    return String(_string_buffer);
+    char buffer[NUMBER_BUFFER_SIZE];
+    return String(StringRef(buffer, FormatDouble(buffer, value, digits)));
 }
 
 //----------------------------------------------------------------------------
 //
-//  Hash-Spezialierung fuer String-Objekte.
+//  Hash-Spezialierung fuer String-Objekte. Das Funktionsobjekt ist
+//  transparent (siehe IsTransparentHash) und liefert fuer const char* und
+//  StringRef denselben Wert wie fuer einen String mit denselben Zeichen.
+//  Ein Dict mit String-Schluesseln kann daher direkt mit allen Typen
+//  durchsucht werden, die sich in einen StringRef umwandeln lassen.
 //
 template <>
 struct DefaultHash<String>
 {
+    typedef StringRef Transparent;
+
     uint operator()(const String& key) const
-    { return HashString(key.CStr()); }
+    { return key.Hash(); }
+
+    uint operator()(const char* key) const
+    { return HashString(key); }
+
+    uint operator()(const StringRef& key) const
+    { return HashBuffer(key.Data(), key.Length()); }
 };
 
 //----------------------------------------------------------------------------
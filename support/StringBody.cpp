@@ -2,40 +2,30 @@
 #include "support/Utilities.h"
 
 #include <cstring>
+#include <new>
 
 //----------------------------------------------------------------------------
 
-StringBody::StringBody(const char* str)
-    : refCount(1),
-      length(strnlen(str, MAX_CAPACITY))
+StringBody* StringBody::Create(uint capacity, const char* str)
 {
-    capacity = length > 0 ? length : DEFAULT_CAPACITY;
-    data = new char[capacity + 1];
-    strncpy(data, str, capacity);
-    data[capacity] = '\0';
-}
+    void* memory = ::operator new(sizeof(StringBody) + capacity);
+    StringBody* body = new (memory) StringBody;
 
-//----------------------------------------------------------------------------
+    body->capacity = capacity;
+    body->length = strnlen(str, capacity);
 
-StringBody::StringBody(uint capacity, const char* str)
-    : refCount(1),
-      capacity(capacity),
-      length(strnlen(str, capacity))
-{
-    data = new char[capacity + 1];
-    strncpy(data, str, capacity);
-    data[capacity] = '\0';
+    memcpy(body->data, str, body->length);
+    body->data[body->length] = '\0';
+
+    return body;
 }
 
 //----------------------------------------------------------------------------
 
-StringBody::StringBody(char* data, uint capacity)
-    : refCount(1),
-      capacity(capacity),
-      data(data)
+void StringBody::Destroy(StringBody* body)
 {
-    length = strnlen(data, capacity);
-    data[length] = '\0';
+    body->~StringBody();
+    ::operator delete(body);
 }
 
 //----------------------------------------------------------------------------
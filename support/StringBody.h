@@ -1,6 +1,8 @@
 #ifndef support_StringBody_h
 #define support_StringBody_h
 
+#include "support/Atomic.h"
+#include "support/Hash.h"
 #include "support/Utilities.h"
 
 //----------------------------------------------------------------------------
@@ -9,36 +11,109 @@
 //  Klasse ermoeglicht es, dass mehrere Strings eine Zeichenkette gemeinsam
 //  verwenden koennen.
 //
+//  Verwaltungsdaten und Zeichenkette liegen in einem gemeinsamen
+//  Speicherblock: data ist das letzte Datenelement und wird bei der
+//  Erzeugung auf capacity + 1 Zeichen verlaengert. Objekte werden deshalb
+//  nur mit Create() angelegt und mit Destroy() bzw. ReleaseRef() geloescht.
+//
+//  Wird das Programm mit dem Makro STRING_ATOMIC_REFCOUNT uebersetzt, sind
+//  Referenzzaehler und Hashwert atomare Variablen. Strings, die sich eine
+//  Zeichenkette teilen, koennen dann in verschiedenen Threads verwendet
+//  werden; jedes einzelne String-Objekt darf aber weiterhin nur von einem
+//  Thread zur Zeit benutzt werden. Ohne das Makro entfallen die Kosten der
+//  atomaren Operationen. Das Makro muss fuer alle Uebersetzungseinheiten
+//  gleich gesetzt sein.
+//
 struct StringBody
 {
-    static const uint DEFAULT_CAPACITY  = 20;
-    static const uint MAX_CAPACITY      = 1u << 31;
+    static const uint   MAX_CAPACITY    = 1u << 31;
+    static const double GROWTH_FACTOR   = 1.5;
 
     //
-    //  Erstellt eine Zeichenkette durch Kopieren von str. Wird fuer str
-    //  eine leere Zeichenkette ("") uebergeben, wird Speicher der Laenge
-    //  StringBody::DEFAULT_CAPACITY reserviert.
+    //  Reserviert Speicher, um eine Zeichenkette der Laenge capacity
+    //  aufnehmen zu koennen und initialisiert ihn mit hoechstens capacity
+    //  Zeichen von str.
     //
-    explicit StringBody(const char* str = "");
+    static StringBody* Create(uint capacity, const char* str = "");
 
     //
-    //  Reserviert Speicher, um eine Zeichenkette der Laenge capacity
-    //  aufnehmen zu koennen und initialisiert ihn mit str.
+    //  Gibt den Speicher von body frei.
+    //
+    static void Destroy(StringBody* body);
+
+    //
+    //  Liefert die Kapazitaet, auf die eine Zeichenkette mit der Kapazitaet
+    //  capacity wachsen soll, damit sie mindestens required Zeichen
+    //  aufnehmen kann. Die Kapazitaet waechst mindestens um GROWTH_FACTOR,
+    //  so dass wiederholtes Anhaengen insgesamt lineare Zeit benoetigt.
+    //
+    static uint GrowCapacity(uint capacity, uint required)
+    {
+        uint grown = capacity < MAX_CAPACITY / GROWTH_FACTOR
+            ? uint(capacity * GROWTH_FACTOR) : MAX_CAPACITY;
+
+        return Max(grown, required);
+    }
+
+#ifdef STRING_ATOMIC_REFCOUNT
+
+    //
+    //  Erhoeht den Referenzzaehler um 1. Wer eine neue Referenz anlegt,
+    //  besitzt bereits eine und hat die Zeichenkette damit schon gesehen;
+    //  es genuegt deshalb eine Operation ohne Synchronisation.
+    //
+    void AddRef()
+    { refCount.FetchAdd(1, MEMORY_ORDER_RELAXED); }
+
+    //
+    //  Verringert den Referenzzaehler um 1 und loescht das Objekt, wenn der
+    //  Zaehler danach kleiner oder gleich 0 ist. Die Freigabe macht alle
+    //  vorherigen Zugriffe fuer den Thread sichtbar, der das Objekt
+    //  schliesslich loescht.
+    //
+    void ReleaseRef()
+    {
+        if (refCount.FetchSub(1, MEMORY_ORDER_ACQ_REL) <= 1)
+            Destroy(this);
+    }
+
+    //
+    //  Liefert true, wenn mehr als ein String die Zeichenkette verwendet.
+    //  Liefert die Funktion false, darf die Zeichenkette veraendert werden.
     //
-    explicit StringBody(uint capacity, const char* str = "");
+    bool IsShared() const
+    { return refCount.Load(MEMORY_ORDER_ACQUIRE) > 1; }
 
     //
-    //  Uebernimmt die Zeichenkette str, ohne neuen Speicher zu reservieren.
-    //  data muss ein mit new reserviertes Array mindestens der Groesse
-    //  capacity sein.
+    //  Liefert den Hashwert der Zeichenkette. Der Wert wird beim ersten
+    //  Aufruf berechnet und gespeichert; HashBuffer() liefert nie 0, so dass
+    //  0 einen noch nicht berechneten Wert kennzeichnet. Berechnen mehrere
+    //  Threads ihn gleichzeitig, schreiben sie denselben Wert.
     //
-    StringBody(char* data, uint capacity);
+    uint Hash()
+    {
+        uint value = hash.Load(MEMORY_ORDER_RELAXED);
+
+        if (value == 0)
+        {
+            value = HashBuffer(data, length);
+            hash.Store(value, MEMORY_ORDER_RELAXED);
+        }
+
+        return value;
+    }
 
     //
-    //  Gibt den fuer die Zeichenkette reservierten Speicher wieder frei.
+    //  Verwirft den gespeicherten Hashwert. Muss nach jeder Aenderung der
+    //  Zeichenkette aufgerufen werden.
     //
-    ~StringBody()
-    { delete[] data; }
+    void ResetHash()
+    { hash.Store(0, MEMORY_ORDER_RELAXED); }
+
+    Atomic<int>     refCount;
+    Atomic<uint>    hash;
+
+#else
 
     //
     //  Erhoeht den Referenzzaehler um 1.
@@ -48,21 +123,53 @@ struct StringBody
 
     //
     //  Verringert den Referenzzaehler um 1 und loescht das Objekt, wenn der
-    //  Zaehler danach kleiner oedr gleich 0 ist.
+    //  Zaehler danach kleiner oder gleich 0 ist.
     //
     void ReleaseRef()
     {
         if (--refCount <= 0)
-            delete this;
+            Destroy(this);
     }
 
-    int     refCount;
-    uint    capacity;
-    uint    length;
-    char*   data;
+    //
+    //  Liefert true, wenn mehr als ein String die Zeichenkette verwendet.
+    //
+    bool IsShared() const
+    { return refCount > 1; }
+
+    //
+    //  Liefert den Hashwert der Zeichenkette. Der Wert wird beim ersten
+    //  Aufruf berechnet und gespeichert; HashBuffer() liefert nie 0, so dass
+    //  0 einen noch nicht berechneten Wert kennzeichnet.
+    //
+    uint Hash()
+    {
+        if (hash == 0)
+            hash = HashBuffer(data, length);
+
+        return hash;
+    }
+
+    //
+    //  Verwirft den gespeicherten Hashwert. Muss nach jeder Aenderung der
+    //  Zeichenkette aufgerufen werden.
+    //
+    void ResetHash()
+    { hash = 0; }
+
+    int             refCount;
+    uint            hash;
+
+#endif
+
+    uint            capacity;
+    uint            length;
+    char            data[1];
 
 private:
 
+    StringBody()
+        : refCount(1), hash(0) {}
     StringBody(const StringBody&);
     StringBody& operator=(const StringBody&);
 };
@@ -0,0 +1,85 @@
+#include "support/StringBuilder.h"
+
+#include <cstring>
+
+//----------------------------------------------------------------------------
+
+void StringBuilder::Reserve(uint capacity)
+{
+    if (capacity <= Capacity())
+        return;
+
+    StringBody* body = StringBody::Create(capacity);
+
+    if (m_body != nullptr)
+    {
+        memcpy(body->data, m_body->data, m_body->length);
+        body->length = m_body->length;
+        StringBody::Destroy(m_body);
+    }
+
+    m_body = body;
+}
+
+//----------------------------------------------------------------------------
+
+StringBuilder& StringBuilder::Append(const StringRef& str)
+{
+    uint length = Length();
+    uint new_length = length + str.Length();
+
+    if (m_body != nullptr && new_length <= m_body->capacity)
+    {
+        memcpy(m_body->data + length, str.Data(), str.Length());
+        m_body->length = new_length;
+        return *this;
+    }
+
+    //  str kann auf den eigenen Puffer verweisen und wird deshalb kopiert,
+    //  bevor der bisherige Puffer freigegeben wird.
+
+    StringBody* body = StringBody::Create(
+        StringBody::GrowCapacity(Capacity(), new_length));
+
+    if (m_body != nullptr)
+        memcpy(body->data, m_body->data, length);
+
+    memcpy(body->data + length, str.Data(), str.Length());
+    body->length = new_length;
+
+    if (m_body != nullptr)
+        StringBody::Destroy(m_body);
+
+    m_body = body;
+
+    return *this;
+}
+
+//----------------------------------------------------------------------------
+
+String StringBuilder::Take()
+{
+    uint length = Length();
+
+    if (length <= String::INLINE_CAPACITY)
+    {
+        String str(StringRef(*this));
+        Clear();
+        return str;
+    }
+
+    StringBody* body = m_body;
+    m_body = nullptr;
+
+    body->data[length] = '\0';
+    return String(body);
+}
+
+//----------------------------------------------------------------------------
+
+void StringBuilder::Grow(uint required)
+{
+    Reserve(StringBody::GrowCapacity(Capacity(), required));
+}
+
+//----------------------------------------------------------------------------
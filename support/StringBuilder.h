@@ -0,0 +1,190 @@
+#ifndef support_StringBuilder_h
+#define support_StringBuilder_h
+
+#include "support/NumberFormat.h"
+#include "support/String.h"
+#include "support/StringBody.h"
+#include "support/StringRef.h"
+#include "support/Utilities.h"
+
+//----------------------------------------------------------------------------
+//
+//  Klasse zum schrittweisen Aufbau einer Zeichenkette.
+//
+//  Ein StringBuilder verwaltet einen eigenen Puffer, der beim Anhaengen um
+//  StringBody::GROWTH_FACTOR waechst, so dass n angehaengte Zeichen
+//  insgesamt O(n) Zeit benoetigen. Ist die Endlaenge ungefaehr bekannt,
+//  kann der Puffer mit Reserve() oder im Konstruktor vorab reserviert
+//  werden. Take() uebergibt den Puffer ohne Kopie an einen String.
+//
+class StringBuilder
+{
+public:
+
+    //
+    //  Erstellt einen leeren StringBuilder. Ist capacity groesser als 0,
+    //  wird Platz fuer capacity Zeichen reserviert.
+    //
+    explicit StringBuilder(uint capacity = 0)
+        : m_body(nullptr)
+    { Reserve(capacity); }
+
+    //
+    //  Gibt den Puffer frei.
+    //
+    ~StringBuilder()
+    {
+        if (m_body != nullptr)
+            StringBody::Destroy(m_body);
+    }
+
+    //
+    //  Liefert die Laenge der bisher aufgebauten Zeichenkette.
+    //
+    uint Length() const
+    { return m_body != nullptr ? m_body->length : 0; }
+
+    //
+    //  Liefert die Anzahl der Zeichen, die ohne neue Speicheranforderung
+    //  aufgenommen werden koennen.
+    //
+    uint Capacity() const
+    { return m_body != nullptr ? m_body->capacity : 0; }
+
+    //
+    //  Liefert einen Verweis auf die bisher aufgebaute Zeichenkette. Der
+    //  Verweis ist nur gueltig, bis der StringBuilder veraendert wird.
+    //
+    operator StringRef() const
+    {
+        return m_body != nullptr
+            ? StringRef(m_body->data, m_body->length) : StringRef();
+    }
+
+    //
+    //  Reserviert Platz fuer mindestens capacity Zeichen.
+    //
+    void Reserve(uint capacity);
+
+    //
+    //  Haengt die Zeichenfolge str bzw. das Zeichen c an.
+    //
+    StringBuilder& Append(const StringRef& str);
+
+    StringBuilder& Append(char c)
+    {
+        uint length = Length();
+
+        if (length == Capacity())
+            Grow(length + 1);
+
+        m_body->data[length] = c;
+        m_body->length = length + 1;
+
+        return *this;
+    }
+
+    //
+    //  Haengt die Dezimaldarstellung von value an, ohne einen
+    //  Zwischenpuffer oder String anzulegen. Fuer digits gilt dasselbe wie
+    //  bei FormatDouble().
+    //
+    StringBuilder& AppendNumber(int value)
+    {
+        char* tail = Tail();
+        m_body->length += FormatInteger(tail, value);
+        return *this;
+    }
+
+    StringBuilder& AppendNumber(uint value)
+    {
+        char* tail = Tail();
+        m_body->length += FormatInteger(tail, value);
+        return *this;
+    }
+
+    StringBuilder& AppendNumber(long value)
+    {
+        char* tail = Tail();
+        m_body->length += FormatInteger(tail, value);
+        return *this;
+    }
+
+    StringBuilder& AppendNumber(ulong value)
+    {
+        char* tail = Tail();
+        m_body->length += FormatInteger(tail, value);
+        return *this;
+    }
+
+    StringBuilder& AppendNumber(float value,
+                                int digits = DEFAULT_FLOAT_DIGITS)
+    {
+        char* tail = Tail();
+        m_body->length += FormatFloat(tail, value, digits);
+        return *this;
+    }
+
+    StringBuilder& AppendNumber(double value,
+                                int digits = DEFAULT_FLOAT_DIGITS)
+    {
+        char* tail = Tail();
+        m_body->length += FormatDouble(tail, value, digits);
+        return *this;
+    }
+
+    StringBuilder& operator+=(const StringRef& str)
+    { return Append(str); }
+
+    StringBuilder& operator+=(char c)
+    { return Append(c); }
+
+    //
+    //  Setzt die Laenge auf 0. Der reservierte Speicher bleibt erhalten.
+    //
+    void Clear()
+    {
+        if (m_body != nullptr)
+            m_body->length = 0;
+    }
+
+    //
+    //  Liefert die aufgebaute Zeichenkette als String und leert den
+    //  StringBuilder. Lange Zeichenketten werden ohne Kopie uebergeben; der
+    //  Puffer gehoert danach dem String. Kurze Zeichenketten werden im
+    //  String gespeichert, und der Puffer bleibt fuer weitere Aufrufe
+    //  erhalten.
+    //
+    String Take();
+
+private:
+
+    StringBuilder(const StringBuilder&);
+    StringBuilder& operator=(const StringBuilder&);
+
+    //
+    //  Vergroessert den Puffer so, dass er mindestens required Zeichen
+    //  aufnehmen kann.
+    //
+    void Grow(uint required);
+
+    //
+    //  Stellt Platz fuer NUMBER_BUFFER_SIZE Zeichen am Ende bereit und
+    //  liefert einen Zeiger hinter das letzte Zeichen.
+    //
+    char* Tail()
+    {
+        uint length = Length();
+
+        if (length + NUMBER_BUFFER_SIZE > Capacity())
+            Grow(length + NUMBER_BUFFER_SIZE);
+
+        return m_body->data + length;
+    }
+
+    StringBody* m_body;
+};
+
+//----------------------------------------------------------------------------
+
+#endif
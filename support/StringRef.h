@@ -0,0 +1,204 @@
+#ifndef support_StringRef_h
+#define support_StringRef_h
+
+#include "support/Hash.h"
+#include "support/Utilities.h"
+
+#include <cstring>
+
+//----------------------------------------------------------------------------
+//
+//  Verweis auf eine Zeichenfolge, die an anderer Stelle gespeichert ist.
+//
+//  Ein StringRef besteht nur aus einem Zeiger und einer Laenge und besitzt
+//  die Zeichen nicht. Es kann daher ohne Speicheranforderung aus einem
+//  String, einer Null-terminierten Zeichenkette oder einem Ausschnitt
+//  davon erzeugt werden, etwa um in einem Dict mit String-Schluesseln zu
+//  suchen. Die Zeichenfolge muss nicht Null-terminiert sein und muss
+//  mindestens so lange gueltig bleiben wie der StringRef.
+//
+class StringRef
+{
+public:
+
+    static const uint   NOT_FOUND = ~0u;
+
+    //
+    //  Erzeugt einen Verweis auf eine leere Zeichenfolge.
+    //
+    StringRef()
+        : m_data(""), m_length(0) {}
+
+    //
+    //  Erzeugt einen Verweis auf die Null-terminierte Zeichenkette str.
+    //
+    StringRef(const char* str)
+        : m_data(str), m_length(strlen(str)) {}
+
+    //
+    //  Erzeugt einen Verweis auf die length Zeichen ab data.
+    //
+    StringRef(const char* data, uint length)
+        : m_data(data), m_length(length) {}
+
+    //
+    //  Liefert einen Zeiger auf das erste Zeichen. Die Zeichenfolge ist
+    //  nicht notwendigerweise Null-terminiert.
+    //
+    const char* Data() const
+    { return m_data; }
+
+    //
+    //  Liefert die Laenge der Zeichenfolge.
+    //
+    uint Length() const
+    { return m_length; }
+
+    //
+    //  Liefert true, wenn die Zeichenfolge leer ist.
+    //
+    bool IsEmpty() const
+    { return m_length == 0; }
+
+    //
+    //  Liefert Lesezugriff auf einzelne Zeichen.
+    //
+    const char& operator[](uint index) const
+    { return m_data[index]; }
+
+    //
+    //  Liefert einen Verweis auf die ersten bzw. letzten count Zeichen.
+    //  Ist count groesser als die Laenge, wird die ganze Zeichenfolge
+    //  geliefert.
+    //
+    StringRef Left(uint count) const
+    { return StringRef(m_data, Min(count, m_length)); }
+
+    StringRef Right(uint count) const
+    {
+        count = Min(count, m_length);
+        return StringRef(m_data + m_length - count, count);
+    }
+
+    //
+    //  Liefert einen Verweis auf hoechstens count Zeichen ab der Position
+    //  first (von 0 an gerechnet).
+    //
+    StringRef Mid(uint first, uint count) const
+    {
+        first = Min(first, m_length);
+        return StringRef(m_data + first, Min(count, m_length - first));
+    }
+
+    //
+    //  Liefert die Position des ersten Zeichens c ab der Position start
+    //  oder NOT_FOUND, wenn das Zeichen nicht vorkommt.
+    //
+    uint Find(char c, uint start = 0) const
+    {
+        if (start >= m_length)
+            return NOT_FOUND;
+
+        const void* p = memchr(m_data + start, c, m_length - start);
+        return p != nullptr ? (const char*) p - m_data : NOT_FOUND;
+    }
+
+private:
+
+    const char* m_data;
+    uint        m_length;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Testet zwei Zeichenfolgen auf Gleichheit.
+//
+inline bool operator==(const StringRef& str1, const StringRef& str2)
+{
+    return str1.Length() == str2.Length()
+        && memcmp(str1.Data(), str2.Data(), str1.Length()) == 0;
+}
+
+inline bool operator==(const StringRef& str1, const char* str2)
+{ return str1 == StringRef(str2); }
+
+inline bool operator==(const char* str1, const StringRef& str2)
+{ return StringRef(str1) == str2; }
+
+//----------------------------------------------------------------------------
+//
+//  Zerlegt eine Zeichenfolge in Teilstuecke, die durch eines der Zeichen
+//  aus separators getrennt sind. Aufeinanderfolgende Trennzeichen gelten
+//  als ein Trennzeichen, leere Teilstuecke werden also nicht geliefert.
+//
+//  Die Teilstuecke sind Verweise in die urspruengliche Zeichenfolge; beim
+//  Zerlegen wird kein Speicher angefordert. Die Zeichenfolge und
+//  separators muessen gueltig bleiben, solange der StringTokenizer und die
+//  gelieferten Verweise verwendet werden.
+//
+class StringTokenizer
+{
+public:
+
+    //
+    //  Bereitet das Zerlegen von str vor. Ohne Angabe von separators wird
+    //  an Leerzeichen und Tabulatoren getrennt.
+    //
+    StringTokenizer(const StringRef& str, const char* separators = " \t")
+        : m_str(str), m_separators(separators), m_pos(0) {}
+
+    //
+    //  Speichert das naechste Teilstueck in token und liefert true. Sind
+    //  keine Teilstuecke mehr vorhanden, liefert die Funktion false.
+    //
+    bool Next(StringRef& token)
+    {
+        uint length = m_str.Length();
+
+        while (m_pos < length && IsSeparator(m_str[m_pos]))
+            ++m_pos;
+
+        if (m_pos == length)
+            return false;
+
+        uint first = m_pos;
+
+        while (m_pos < length && !IsSeparator(m_str[m_pos]))
+            ++m_pos;
+
+        token = m_str.Mid(first, m_pos - first);
+        return true;
+    }
+
+    //
+    //  Liefert den noch nicht zerlegten Rest der Zeichenfolge.
+    //
+    StringRef Rest() const
+    { return m_str.Mid(m_pos, m_str.Length()); }
+
+private:
+
+    bool IsSeparator(char c) const
+    { return c != '\0' && strchr(m_separators, c) != nullptr; }
+
+    StringRef   m_str;
+    const char* m_separators;
+    uint        m_pos;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Hash-Spezialisierung fuer StringRef. Liefert denselben Wert wie
+//  HashString() fuer eine Null-terminierte Zeichenkette mit denselben
+//  Zeichen.
+//
+template <>
+struct DefaultHash<StringRef>
+{
+    uint operator()(const StringRef& key) const
+    { return HashBuffer(key.Data(), key.Length()); }
+};
+
+//----------------------------------------------------------------------------
+
+#endif
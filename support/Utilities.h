@@ -13,6 +13,8 @@ typedef unsigned char   uchar;
 typedef unsigned short  ushort;
 typedef unsigned int    uint;
 typedef unsigned long   ulong;
+typedef long long          longlong;
+typedef unsigned long long ulonglong;
 
 //----------------------------------------------------------------------------
 
@@ -98,6 +100,36 @@ inline bool TestBits(uint value, uint bits)
     return (value & bits) == bits;
 }
 
+//----------------------------------------------------------------------------
+//
+//  Stellt den Typ T als EnableIf<...>::Type nur dann bereit, wenn condition
+//  true ist. Damit koennen Template-Funktionen von der Ueberladungsaufloesung
+//  ausgeschlossen werden.
+//
+template <bool condition, class T = void>
+struct EnableIf {};
+
+template <class T>
+struct EnableIf<true, T>
+{
+    typedef T Type;
+};
+
+//----------------------------------------------------------------------------
+//
+//  Bricht die Uebersetzung ab, wenn condition false ist. In Templates wird
+//  die Bedingung erst geprueft, wenn die Funktion mit dem Aufruf
+//  StaticAssert<...>::Check() instanziiert wird.
+//
+template <bool condition>
+struct StaticAssert;
+
+template <>
+struct StaticAssert<true>
+{
+    static void Check() {}
+};
+
 //----------------------------------------------------------------------------
 
 #endif
@@ -2,9 +2,11 @@
 #define support_Vector_h
 
 #include "support/Collection.h"
+#include "support/PointerSearch.h"
 #include "support/Utilities.h"
 
 #include <climits>
+#include <cstring>
 
 //----------------------------------------------------------------------------
 //
@@ -26,8 +28,11 @@
 //  Option auf true gesetzt werden. Die Standardvorgabe ist false, d.h. die
 //  Elemente werden nicht geloescht.
 //
-template <class T>
-class Vector: public Collection<T> {
+//  Alternativ kann ueber den Parameter Ownership eine statische Strategie
+//  (siehe Collection.h) gewaehlt werden.
+//
+template <class T, class Ownership = DynamicOwnership<T> >
+class Vector: public Collection<T, Ownership> {
 
 public:
 
@@ -41,7 +46,8 @@ public:
     //  benoetigt wird, werden jeweils Bloecke der Laenge n*count reserviert.
     //
     Vector(uint capacity = INITIAL_CAPACITY)
-        : m_capacity(capacity), m_count(0), m_data(new T*[capacity]) {}
+        : m_capacity(capacity), m_count(0), m_data(new T*[capacity]),
+          m_buffer(nullptr), m_bufferCapacity(0) {}
 
     //
     //  Entfernt alle Elemente aus dem Vektor und zerstoert das Vector-Objekt.
@@ -55,13 +61,13 @@ public:
     //  leer, werden alle Elemente entfernt und - falls AutoDelete auf true
     //  gesetzt ist - geloescht.
     //
-    Vector<T>& operator=(const Vector<T>& vector);
+    Vector<T, Ownership>& operator=(const Vector<T, Ownership>& vector);
 
     //
     //  Fuegt die Elemente von vector an das Ende des Vektors an. Dabei
     //  werden nur die Zeiger auf die Elemente kopiert.
     //
-    Vector<T>& operator+=(const Vector<T>& vector)
+    Vector<T, Ownership>& operator+=(const Vector<T, Ownership>& vector)
     { return Append(vector); }
 
     //
@@ -169,7 +175,7 @@ public:
     //  Fuegt die Elemente von vector an das Ende des Vektors an. Dabei
     //  werden nur die Zeiger auf die Elemente kopiert.
     //
-    Vector<T>& Append(const Vector<T>& vector);
+    Vector<T, Ownership>& Append(const Vector<T, Ownership>& vector);
 
     //
     //  "Schrumpft" den Vektor auf die minimal benoetigte Groesse (in
@@ -203,6 +209,17 @@ public:
     //
     void Insert(T* data, uint pos);
 
+    //
+    //  Fuegt die count Elemente des Arrays src an der Position pos in den
+    //  Vektor ein. Die nachfolgenden Elemente werden in einem Schritt um
+    //  count Positionen nach hinten verschoben. Fuer jedes Element wird
+    //  NewItem() aufgerufen.
+    //
+    //  Es muss sichergestellt sein, dass pos <= Count() ist und src keine
+    //  Elemente dieses Vektors enthaelt.
+    //
+    void InsertRange(uint pos, T* const* src, uint count);
+
     //
     //  Haengt data an das Ende des Vektors an. Append() ist im allgemeinen
     //  effizienter als Insert(), da keine Elemente verschoben werden muessen.
@@ -240,6 +257,26 @@ public:
     //
     bool RemoveRef(T* data);
 
+    //
+    //  Entfernt die count Elemente ab der Position first. Die nachfolgenden
+    //  Elemente werden in einem Schritt nach vorn verschoben. Ist AutoDelete
+    //  auf true gesetzt, werden die Elemente geloescht.
+    //
+    //  Es muss sichergestellt sein, dass first + count <= Count() ist.
+    //
+    void RemoveRange(uint first, uint count);
+
+    //
+    //  Entfernt alle Elemente, fuer die pred true liefert, in einem einzigen
+    //  Durchlauf. pred muss eine Funktion mit einem Parameter vom Typ T*
+    //  oder ein entsprechendes Funktionsobjekt sein. Die Reihenfolge der
+    //  verbleibenden Elemente bleibt erhalten. Ist AutoDelete auf true
+    //  gesetzt, werden die entfernten Elemente geloescht.
+    //
+    //  Die Funktion liefert die Anzahl der entfernten Elemente.
+    //
+    template <class Pred> uint RemoveIf(Pred pred);
+
     //
     //  Entfernt das Element an der Position pos ohne es zu loeschen,
     //  unabhaengig von AutoDelete. Die Funktion liefert einen Zeiger auf das
@@ -262,13 +299,31 @@ public:
     //
     template <class Fn> void DoForEach(Fn func) const;
 
+protected:
+
+    //
+    //  Erstellt einen Vektor, der das Array buffer der Groesse
+    //  bufferCapacity als internen Speicher verwendet, solange nicht mehr
+    //  als bufferCapacity Elemente gespeichert werden. Erst wenn der Vektor
+    //  ueber diese Groesse hinaus waechst, wird Speicher reserviert. Ist
+    //  capacity groesser als bufferCapacity, wird sofort Speicher der Groesse
+    //  capacity reserviert. buffer muss mindestens so lange existieren wie
+    //  das Vector-Objekt (siehe SmallVector).
+    //
+    Vector(T** buffer, uint bufferCapacity, uint capacity)
+        : m_capacity(capacity > bufferCapacity ? capacity : bufferCapacity),
+          m_count(0),
+          m_data(capacity > bufferCapacity ? new T*[capacity] : buffer),
+          m_buffer(buffer),
+          m_bufferCapacity(bufferCapacity) {}
+
 private:
 
     //
     //  Collections koennen nicht kopiert werden, weil ein ueberschriebenes
     //  NewItem() nicht von einem Konstruktor aus aufgerufen werden kann.
     //
-    Vector(const Vector<T>&);
+    Vector(const Vector<T, Ownership>&);
 
     //
     //  Ersetzt m_data durch ein neu reserviertes Array der Groesse max(size,
@@ -281,30 +336,40 @@ private:
 
     bool Grow();
 
+    //
+    //  Gibt m_data frei, falls es sich nicht um den internen Speicher
+    //  m_buffer handelt.
+    //
+    void FreeData()
+    { if (m_data != m_buffer) delete[] m_data; }
+
     uint    m_capacity;
     uint    m_count;
     T**     m_data;
+    T**     m_buffer;
+    uint    m_bufferCapacity;
 };
 
 //----------------------------------------------------------------------------
 
-template <class T>
-Vector<T>::~Vector()
+template <class T, class Ownership>
+Vector<T, Ownership>::~Vector()
 {
     Clear();
-    delete[] m_data;
+    FreeData();
 }
 
 //----------------------------------------------------------------------------
 
-template <class T>
-Vector<T>& Vector<T>::operator=(const Vector<T>& vector)
+template <class T, class Ownership>
+Vector<T, Ownership>&
+Vector<T, Ownership>::operator=(const Vector<T, Ownership>& vector)
 {
     if (this != &vector)
     {
         Clear();
         Append(vector);
-        this->SetAutoDelete(false);
+        this->AssignedFrom();
     }
 
     return *this;
@@ -312,22 +377,22 @@ Vector<T>& Vector<T>::operator=(const Vector<T>& vector)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-Vector<T>& Vector<T>::Append(const Vector<T>& vector)
+template <class T, class Ownership>
+Vector<T, Ownership>&
+Vector<T, Ownership>::Append(const Vector<T, Ownership>& vector)
 {
+    this->CheckShareable();
     Reserve(m_count + vector.m_count);
 
-    for (int i = 0; i < vector.m_count; ++i)
-        m_data[m_count + i] = this->NewItem(vector.m_data[i]);
-
+    this->NewItems(m_data + m_count, vector.m_data, vector.m_count);
     m_count += vector.m_count;
     return *this;
 }
 
 //----------------------------------------------------------------------------
 
-template <class T>
-void Vector<T>::SetAt(uint pos, T* data)
+template <class T, class Ownership>
+void Vector<T, Ownership>::SetAt(uint pos, T* data)
 {
     if (pos >= m_count)
         return;
@@ -338,32 +403,46 @@ void Vector<T>::SetAt(uint pos, T* data)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-void Vector<T>::Clear()
+template <class T, class Ownership>
+void Vector<T, Ownership>::Clear()
 {
-    for (int i = 0; i < m_count; ++i)
-        this->DeleteItem(m_data[i]);
-
+    this->DeleteItems(m_data, m_count);
     m_count = 0;
 }
 
 //----------------------------------------------------------------------------
 
-template <class T>
-bool Vector<T>::Resize(uint size)
+template <class T, class Ownership>
+bool Vector<T, Ownership>::Resize(uint size)
 {
     if (size < MIN_CAPACITY)
         size = MIN_CAPACITY;
 
-    if (size == m_capacity || size < m_count)
-        false;
+    if (size < m_count)
+        return false;
+
+    T** new_data;
 
-    T** new_data = new T*[size];
+    if (size <= m_bufferCapacity)
+    {
+        if (m_data == m_buffer)
+            return false;
+
+        new_data = m_buffer;
+        size = m_bufferCapacity;
+    }
+    else
+    {
+        if (size == m_capacity)
+            return false;
+
+        new_data = new T*[size];
+    }
 
     for (int i = 0; i < m_count; ++i)
         new_data[i] = m_data[i];
 
-    delete[] m_data;
+    FreeData();
     m_data = new_data;
     m_capacity = size;
 
@@ -372,8 +451,8 @@ bool Vector<T>::Resize(uint size)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-bool Vector<T>::Grow()
+template <class T, class Ownership>
+bool Vector<T, Ownership>::Grow()
 {
     if (m_capacity == MAX_CAPACITY)
         return false;
@@ -388,14 +467,13 @@ bool Vector<T>::Grow()
 
 //----------------------------------------------------------------------------
 
-template <class T>
-void Vector<T>::Insert(T* data, uint pos)
+template <class T, class Ownership>
+void Vector<T, Ownership>::Insert(T* data, uint pos)
 {
     if (m_capacity <= m_count)
         Grow();
 
-    for (int i = m_count; i > pos; --i)
-        m_data[i] = m_data[i - 1];
+    memmove(m_data + pos + 1, m_data + pos, (m_count - pos) * sizeof(T*));
 
     m_data[pos] = this->NewItem(data);
     ++m_count;
@@ -403,20 +481,37 @@ void Vector<T>::Insert(T* data, uint pos)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-void Vector<T>::Append(T* data)
+template <class T, class Ownership>
+void Vector<T, Ownership>::InsertRange(uint pos, T* const* src, uint count)
+{
+    if (m_capacity < m_count + count)
+    {
+        uint new_size = m_capacity * GROWTH_FACTOR;
+        Resize(Max(new_size, m_count + count));
+    }
+
+    memmove(m_data + pos + count, m_data + pos, (m_count - pos) * sizeof(T*));
+
+    this->NewItems(m_data + pos, src, count);
+    m_count += count;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+void Vector<T, Ownership>::Append(T* data)
 {
     if (m_capacity <= m_count)
         Grow();
 
-    m_data[m_count - 1] = this->NewItem(data);
+    m_data[m_count] = this->NewItem(data);
     ++m_count;
 }
 
 //----------------------------------------------------------------------------
 
-template <class T>
-uint Vector<T>::FindNext(const T& data, uint pos) const
+template <class T, class Ownership>
+uint Vector<T, Ownership>::FindNext(const T& data, uint pos) const
 {
     int p;
 
@@ -431,24 +526,19 @@ uint Vector<T>::FindNext(const T& data, uint pos) const
 
 //----------------------------------------------------------------------------
 
-template <class T>
-uint Vector<T>::FindNextRef(const T* data, uint pos) const
+template <class T, class Ownership>
+uint Vector<T, Ownership>::FindNextRef(const T* data, uint pos) const
 {
-    int p;
-
-    for (p = pos; p < m_count; ++p)
-    {
-        if (m_data[p] == data)
-            break;
-    }
+    if (pos >= m_count)
+        return m_count;
 
-    return p;
+    return pos + FindPointer(m_data + pos, m_count - pos, data);
 }
 
 //----------------------------------------------------------------------------
 
-template <class T>
-bool Vector<T>::Remove(const T& data)
+template <class T, class Ownership>
+bool Vector<T, Ownership>::Remove(const T& data)
 {
     uint p = Find(data);
 
@@ -461,8 +551,8 @@ bool Vector<T>::Remove(const T& data)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-bool Vector<T>::RemoveRef(T* data)
+template <class T, class Ownership>
+bool Vector<T, Ownership>::RemoveRef(T* data)
 {
     uint p = FindRef(data);
 
@@ -475,14 +565,12 @@ bool Vector<T>::RemoveRef(T* data)
 
 //----------------------------------------------------------------------------
 
-template <class T>
-T* Vector<T>::Take(uint pos)
+template <class T, class Ownership>
+T* Vector<T, Ownership>::Take(uint pos)
 {
     T* data = m_data[pos];
 
-    for (int i = pos; i < m_count - 1; ++i)
-        m_data[i] = m_data[i + 1];
-
+    memmove(m_data + pos, m_data + pos + 1, (m_count - pos - 1) * sizeof(T*));
     --m_count;
 
     return data;
@@ -490,9 +578,45 @@ T* Vector<T>::Take(uint pos)
 
 //----------------------------------------------------------------------------
 
-template <class T>
+template <class T, class Ownership>
+void Vector<T, Ownership>::RemoveRange(uint first, uint count)
+{
+    uint last = first + count;
+
+    this->DeleteItems(m_data + first, count);
+    memmove(m_data + first, m_data + last, (m_count - last) * sizeof(T*));
+    m_count -= count;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
+template <class Pred>
+uint Vector<T, Ownership>::RemoveIf(Pred pred)
+{
+    uint count = 0;
+
+    for (uint i = 0; i < m_count; ++i)
+    {
+        T* data = m_data[i];
+
+        if (pred(data))
+            this->DeleteItem(data);
+        else
+            m_data[count++] = data;
+    }
+
+    uint removed = m_count - count;
+    m_count = count;
+
+    return removed;
+}
+
+//----------------------------------------------------------------------------
+
+template <class T, class Ownership>
 template <class Fn>
-void Vector<T>::DoForEach(Fn fn) const
+void Vector<T, Ownership>::DoForEach(Fn fn) const
 {
     for (int i = 0; i < m_count; ++i)
         fn(m_data[i]);